@@ -50,7 +50,7 @@ public:
     void RegisterToWorld(GameWorld& world) {
         // Capture weak_ptr to prevent extending lifetime
         std::weak_ptr<Enemy> weakSelf = shared_from_this();
-        world.OnDayNightChanged().Bind(&Enemy::OnWorldTimeChanged, weakSelf);
+        world.OnDayNightChanged().Bind<&Enemy::OnWorldTimeChanged>(weakSelf);
     }
 
     void Destroy() {
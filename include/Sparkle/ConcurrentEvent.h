@@ -0,0 +1,1405 @@
+#ifndef SPARKLE_CONCURRENT_EVENT_H
+#define SPARKLE_CONCURRENT_EVENT_H
+
+#include "Event.h"
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+namespace Sparkle
+{
+    /// Epoch-based memory reclamation shared by every concurrent event.
+    /// Readers enter a critical section without locking, writers retire what they unpublished and it is freed once
+    /// no reader that could still see it is left. Internal use only
+    class EpochDomain
+    {
+    private:
+        static constexpr std::uint64_t Quiescent = 0;
+
+        /// Per-thread reader state, padded to its own cache line. Records are reused once their thread exits
+        struct alignas(64) Record
+        {
+            /// Epoch observed when the outermost critical section started, Quiescent outside of it
+            std::atomic<std::uint64_t> LocalEpoch{Quiescent};
+            std::atomic<bool> InUse{true};
+            /// Critical section nesting. Only touched by the owning thread
+            std::size_t Depth = 0;
+            Record *Next = nullptr;
+        };
+
+        struct Retired
+        {
+            void *Pointer;
+            void (*Deleter)(void *);
+            std::uint64_t Epoch;
+        };
+
+        /// Unregisters the thread record when the thread exits
+        struct ThreadHandle
+        {
+            Record *Owned;
+            explicit ThreadHandle(EpochDomain &domain) : Owned(domain.Acquire()) {}
+            ~ThreadHandle() { Owned->InUse.store(false, std::memory_order_release); }
+        };
+
+        std::atomic<std::uint64_t> GlobalEpoch{1};
+        std::atomic<Record *> Records{nullptr};
+        std::mutex RetiredMutex{};
+        std::vector<Retired> RetiredList{};
+
+        Record *Acquire()
+        {
+            for (Record *record = Records.load(std::memory_order_acquire); record != nullptr; record = record->Next)
+            {
+                bool free = false;
+                if (!record->InUse.load(std::memory_order_relaxed)
+                    && record->InUse.compare_exchange_strong(free, true, std::memory_order_acq_rel))
+                {
+                    return record;
+                }
+            }
+            auto *record = new Record();
+            Record *head = Records.load(std::memory_order_relaxed);
+            do
+            {
+                record->Next = head;
+            } while (!Records.compare_exchange_weak(head, record, std::memory_order_acq_rel, std::memory_order_relaxed));
+            return record;
+        }
+
+        Record &Local()
+        {
+            static thread_local ThreadHandle handle(*this);
+            return *handle.Owned;
+        }
+
+        /// Advance the global epoch if every reader inside a critical section already observed it
+        bool TryAdvance()
+        {
+            std::uint64_t epoch = GlobalEpoch.load(std::memory_order_seq_cst);
+            for (Record *record = Records.load(std::memory_order_acquire); record != nullptr; record = record->Next)
+            {
+                const std::uint64_t local = record->LocalEpoch.load(std::memory_order_seq_cst);
+                if (local != Quiescent && local != epoch) return false;
+            }
+            return GlobalEpoch.compare_exchange_strong(epoch, epoch + 1, std::memory_order_seq_cst);
+        }
+
+        /// Free what was retired at least two epochs ago. Requires RetiredMutex
+        void Reclaim()
+        {
+            const std::uint64_t epoch = GlobalEpoch.load(std::memory_order_seq_cst);
+            std::size_t write = 0;
+            for (auto &retired : RetiredList)
+            {
+                if (retired.Epoch + 2 <= epoch) retired.Deleter(retired.Pointer);
+                else RetiredList[write++] = retired;
+            }
+            RetiredList.resize(write);
+        }
+
+    public:
+        EpochDomain() = default;
+        EpochDomain(const EpochDomain &) = delete;
+        EpochDomain &operator=(const EpochDomain &) = delete;
+
+        ~EpochDomain()
+        {
+            for (auto &retired : RetiredList) retired.Deleter(retired.Pointer);
+            Record *record = Records.load(std::memory_order_acquire);
+            while (record != nullptr)
+            {
+                Record *next = record->Next;
+                delete record;
+                record = next;
+            }
+        }
+
+        /// The domain shared by every concurrent event. Intentionally leaked: threads release their record when they exit,
+        /// which may happen after static destruction started, e.g. the AsyncWorker::Shared() thread
+        static EpochDomain &Instance()
+        {
+            static EpochDomain &domain = *new EpochDomain();
+            return domain;
+        }
+
+        /// Start a read-side critical section. Lock-free, nestable
+        void Enter()
+        {
+            Record &record = Local();
+            if (record.Depth++ == 0) record.LocalEpoch.store(GlobalEpoch.load(std::memory_order_relaxed), std::memory_order_seq_cst);
+        }
+
+        void Exit()
+        {
+            Record &record = Local();
+            if (--record.Depth == 0) record.LocalEpoch.store(Quiescent, std::memory_order_release);
+        }
+
+        /// Free the pointer once every reader that might still see it left its critical section
+        /// \param pointer already unpublished, no new reader can reach it
+        /// \param deleter called with pointer on reclamation
+        void Retire(void *pointer, void (*deleter)(void *))
+        {
+            std::lock_guard<std::mutex> lock(RetiredMutex);
+            RetiredList.push_back(Retired{pointer, deleter, GlobalEpoch.load(std::memory_order_seq_cst)});
+            TryAdvance();
+            Reclaim();
+        }
+
+        /// Block until every critical section that started before this call ended. Must not be called from one
+        void Synchronize()
+        {
+            assert(Local().Depth == 0 && "Synchronize called while raising a concurrent event");
+            const std::uint64_t target = GlobalEpoch.load(std::memory_order_seq_cst) + 2;
+            while (GlobalEpoch.load(std::memory_order_seq_cst) < target)
+            {
+                if (!TryAdvance()) std::this_thread::yield();
+            }
+            std::lock_guard<std::mutex> lock(RetiredMutex);
+            Reclaim();
+        }
+
+        /// RAII read-side critical section
+        class Guard
+        {
+        private:
+            EpochDomain &Domain;
+
+        public:
+            explicit Guard(EpochDomain &domain) : Domain(domain) { Domain.Enter(); }
+            Guard(const Guard &) = delete;
+            Guard &operator=(const Guard &) = delete;
+            ~Guard() { Domain.Exit(); }
+        };
+    };
+
+    /// Thread-safe event. Raise never locks: it reads an immutable listener array published atomically, so any number
+    /// of threads can raise at once. Bind and Remove copy the array, publish the new one and retire the old one through
+    /// epoch-based reclamation; they are serialized with a mutex.
+    /// A Raise that already started may still call a listener after Remove returned. Call Synchronize() before
+    /// destroying an object that was bound by raw pointer. The event itself must not be destroyed while being raised.
+    /// Listeners must be safe to call from several threads at once.
+    /// \tparam Args event arguments
+    template<typename... Args>
+    class ConcurrentEvent : public EventBase, public ConnectionTarget
+    {
+    public:
+        using Callback = Delegate<void(EventParamT<Args>...)>;
+
+    private:
+        /// A bound callback. Immutable once published
+        struct Node
+        {
+            Callback Function;
+            void *Owner;
+            std::uint64_t Id;
+            int Priority;
+        };
+
+        /// Published listener array, sorted by descending priority then bind order. Never modified once published
+        struct Snapshot
+        {
+            std::vector<Node *> Nodes{};
+        };
+
+        std::atomic<Snapshot *> Current{new Snapshot()};
+        /// Serializes Bind and Remove
+        mutable std::mutex WriteMutex{};
+        std::uint64_t NextId = 1;
+
+        static void DeleteNode(void *node) { delete static_cast<Node *>(node); }
+        static void DeleteSnapshot(void *snapshot) { delete static_cast<Snapshot *>(snapshot); }
+
+        static void *StandaloneKey()
+        {
+            static void *StandaloneCallbackKey = reinterpret_cast<void *>(-1);
+            return StandaloneCallbackKey;
+        }
+
+        /// Publish the listener array and retire the previous one. Requires WriteMutex
+        void Publish(Snapshot *snapshot)
+        {
+            Snapshot *previous = Current.exchange(snapshot, std::memory_order_seq_cst);
+            EpochDomain::Instance().Retire(previous, &DeleteSnapshot);
+        }
+
+        Connection InternalBind(Callback f, void *const owner, int priority)
+        {
+            std::lock_guard<std::mutex> lock(WriteMutex);
+            const Snapshot *current = Current.load(std::memory_order_relaxed);
+            auto *node = new Node{std::move(f), owner, NextId++, priority};
+
+            auto *snapshot = new Snapshot();
+            snapshot->Nodes.reserve(current->Nodes.size() + 1);
+            snapshot->Nodes = current->Nodes;
+            auto position = std::partition_point(snapshot->Nodes.begin(), snapshot->Nodes.end(),
+                                                 [priority](const Node *n) { return n->Priority >= priority; });
+            snapshot->Nodes.insert(position, node);
+            Publish(snapshot);
+            return Connection{this, static_cast<std::uint32_t>(node->Id), static_cast<std::uint32_t>(node->Id >> 32)};
+        }
+
+        /// Publish a copy without the listeners matching the predicate, and retire them
+        /// \return removed listeners
+        template<typename Pred>
+        std::size_t RemoveIf(Pred pred)
+        {
+            std::lock_guard<std::mutex> lock(WriteMutex);
+            const Snapshot *current = Current.load(std::memory_order_relaxed);
+            auto *snapshot = new Snapshot();
+            std::vector<Node *> removed;
+            for (Node *node : current->Nodes)
+            {
+                if (pred(*node)) removed.push_back(node);
+                else snapshot->Nodes.push_back(node);
+            }
+            if (removed.empty())
+            {
+                delete snapshot;
+                return 0;
+            }
+            Publish(snapshot);
+            for (Node *node : removed) EpochDomain::Instance().Retire(node, &DeleteNode);
+            return removed.size();
+        }
+
+        static std::uint64_t IdOf(std::uint32_t slot, std::uint32_t generation)
+        {
+            return (static_cast<std::uint64_t>(generation) << 32) | slot;
+        }
+
+    public:
+        explicit ConcurrentEvent(const std::string &name = "") : EventBase(name) {}
+        /// Connections point to their event, so it can't be copied or moved
+        ConcurrentEvent(const ConcurrentEvent &) = delete;
+        ConcurrentEvent &operator=(const ConcurrentEvent &) = delete;
+
+        ~ConcurrentEvent()
+        {
+            Snapshot *current = Current.load(std::memory_order_acquire);
+            for (Node *node : current->Nodes) delete node;
+            delete current;
+        }
+
+        /// Raise/Trigger this Event. Lock-free, callable from any thread
+        /// \param args forwarded to every listener without copies (see EventParam)
+        void Raise(EventParamT<Args>... args) const
+        {
+            EpochDomain::Guard guard(EpochDomain::Instance());
+            const Snapshot *snapshot = Current.load(std::memory_order_seq_cst);
+            for (const Node *node : snapshot->Nodes)
+            {
+                node->Function(args...);
+            }
+        }
+
+        /// Raise/Trigger this Event. Lock-free, callable from any thread
+        inline void operator()(EventParamT<Args>... args) const
+        {
+            Raise(args...);
+        }
+
+        /// Binds this callback to this Event
+        /// \param cb the callback function
+        /// \param priority higher priorities are called first, equal ones in bind order
+        /// \return connection handle, use it to remove only this listener
+        [[maybe_unused]] Connection Bind(Callback cb, int priority = 0)
+        {
+            return InternalBind(std::move(cb), StandaloneKey(), priority);
+        }
+
+        /// Binds this function to the event related to the object, Remove(object) removes it
+        /// \param f function reference
+        /// \param t object pointer
+        /// \param priority higher priorities are called first, equal ones in bind order
+        /// \return connection handle, use it to remove only this listener
+        template<typename T>
+        [[maybe_unused]] Connection Bind(Callback f, T *const t, int priority = 0)
+        {
+            assert(t != nullptr && "Cannot bind to a null pointer");
+            return InternalBind(std::move(f), t, priority);
+        }
+
+        /// Binds this object's function to the event
+        /// \param f member function
+        /// \param t object pointer
+        /// \param priority higher priorities are called first, equal ones in bind order
+        /// \return connection handle, use it to remove only this listener
+        template<typename T>
+        [[maybe_unused]] Connection Bind(void(T::* const f)(Args...), T *const t, int priority = 0)
+        {
+            assert(t != nullptr && "Cannot bind to a null pointer");
+            return InternalBind(Callback(t, f), t, priority);
+        }
+
+        /// Binds this object's member function to the event, resolving the function at compile time
+        /// \tparam Method member function pointer
+        /// \param t object pointer
+        /// \param priority higher priorities are called first, equal ones in bind order
+        /// \return connection handle, use it to remove only this listener
+        template<auto Method, typename T>
+        [[maybe_unused]] Connection Bind(T *const t, int priority = 0)
+        {
+            assert(t != nullptr && "Cannot bind to a null pointer");
+            return InternalBind(Callback::template FromMethod<Method>(t), t, priority);
+        }
+
+        /// Remove all references to the object pointer. Raises already running may still call them, see Synchronize
+        /// \return true if we found and removed the object reference, false otherwise
+        template<typename T>
+        [[maybe_unused]] bool Remove(T *const t)
+        {
+            void *const key = t;
+            return RemoveIf([key](const Node &node) { return node.Owner == key; }) != 0;
+        }
+
+        /// Remove the listener referenced by this connection
+        /// \return true if the listener was still connected and got removed
+        [[maybe_unused]] bool Remove(Connection &connection)
+        {
+            return connection.Disconnect();
+        }
+
+        /// Clears all references from this event
+        [[maybe_unused]] void RemoveAll()
+        {
+            RemoveIf([](const Node &) { return true; });
+        }
+
+        /// Block until every Raise that started before this call returned, on any concurrent event.
+        /// After Remove + Synchronize the removed listeners are never called again. Must not be called from a listener
+        [[maybe_unused]] static void Synchronize()
+        {
+            EpochDomain::Instance().Synchronize();
+        }
+
+        bool Disconnect(std::uint32_t slot, std::uint32_t generation) override
+        {
+            const std::uint64_t id = IdOf(slot, generation);
+            return RemoveIf([id](const Node &node) { return node.Id == id; }) != 0;
+        }
+
+        [[nodiscard]] bool IsConnected(std::uint32_t slot, std::uint32_t generation) const override
+        {
+            const std::uint64_t id = IdOf(slot, generation);
+            std::lock_guard<std::mutex> lock(WriteMutex);
+            const Snapshot *current = Current.load(std::memory_order_relaxed);
+            return std::any_of(current->Nodes.begin(), current->Nodes.end(), [id](const Node *node) { return node->Id == id; });
+        }
+
+        /// How many functions are attached to this event. Already outdated if another thread binds meanwhile
+        [[maybe_unused]] [[nodiscard]] int CallbackCount() const
+        {
+            EpochDomain::Guard guard(EpochDomain::Instance());
+            return static_cast<int>(Current.load(std::memory_order_seq_cst)->Nodes.size());
+        }
+    };
+
+    /// What Post does when a multi-producer ring is full
+    enum class OverflowPolicy
+    {
+        /// Wait for the consumer thread to drain. Never Post from the consumer thread with this policy
+        Block,
+        /// Discard the payload, Post returns false
+        Drop,
+        /// Chain a new ring twice as large. Allocates
+        Grow
+    };
+
+    /// Lock-free multi-producer single-consumer queue over pre-allocated bounded rings.
+    /// Any thread can Push, only one thread at a time may Pop. Internal use only
+    /// \tparam T stored element
+    template<typename T>
+    class MpscQueue
+    {
+    private:
+        /// Set in EnqueuePos once a segment is full and another one is chained after it (Grow)
+        static constexpr std::uint64_t ClosedBit = std::uint64_t{1} << 63;
+
+        /// Ring slot. Sequence tells whether the slot is free for the position pos (== pos) or holds its element (== pos + 1)
+        struct Cell
+        {
+            std::atomic<std::uint64_t> Sequence{0};
+            alignas(T) unsigned char Storage[sizeof(T)];
+
+            T *Get() { return std::launder(reinterpret_cast<T *>(Storage)); }
+        };
+
+        enum class PushResult { Pushed, Full, Closed };
+
+        /// Bounded ring (Vyukov). Only Grow chains more than one
+        struct Segment
+        {
+            const std::size_t Mask;
+            std::unique_ptr<Cell[]> Cells;
+            alignas(64) std::atomic<std::uint64_t> EnqueuePos{0};
+            std::atomic<Segment *> Next{nullptr};
+            /// Only touched by the consumer
+            alignas(64) std::uint64_t DequeuePos = 0;
+
+            explicit Segment(std::size_t capacity) : Mask(capacity - 1), Cells(new Cell[capacity])
+            {
+                for (std::size_t i = 0; i < capacity; ++i) Cells[i].Sequence.store(i, std::memory_order_relaxed);
+            }
+
+            ~Segment()
+            {
+                while (Pop([](T &&) {})) {}
+            }
+
+            template<typename... P>
+            PushResult Push(P &&... args)
+            {
+                std::uint64_t pos = EnqueuePos.load(std::memory_order_relaxed);
+                for (;;)
+                {
+                    if (pos & ClosedBit) return PushResult::Closed;
+                    Cell &cell = Cells[pos & Mask];
+                    const std::uint64_t sequence = cell.Sequence.load(std::memory_order_acquire);
+                    const auto diff = static_cast<std::int64_t>(sequence - pos);
+                    if (diff == 0)
+                    {
+                        if (EnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                        {
+                            ::new(static_cast<void *>(cell.Storage)) T(std::forward<P>(args)...);
+                            cell.Sequence.store(pos + 1, std::memory_order_release);
+                            return PushResult::Pushed;
+                        }
+                    }
+                    else if (diff < 0) return PushResult::Full;
+                    else pos = EnqueuePos.load(std::memory_order_relaxed);
+                }
+            }
+
+            /// Move the oldest element out and free its slot before calling f
+            /// \return false if nothing is ready
+            template<typename F>
+            bool Pop(F &&f)
+            {
+                Cell &cell = Cells[DequeuePos & Mask];
+                if (cell.Sequence.load(std::memory_order_acquire) != DequeuePos + 1) return false;
+                T element(std::move(*cell.Get()));
+                cell.Get()->~T();
+                cell.Sequence.store(DequeuePos + Mask + 1, std::memory_order_release);
+                ++DequeuePos;
+                f(std::move(element));
+                return true;
+            }
+
+            [[nodiscard]] bool Ready() const
+            {
+                return Cells[DequeuePos & Mask].Sequence.load(std::memory_order_acquire) == DequeuePos + 1;
+            }
+
+            /// Fully consumed and no producer can push into it anymore
+            [[nodiscard]] bool Exhausted() const
+            {
+                const std::uint64_t pos = EnqueuePos.load(std::memory_order_acquire);
+                return (pos & ClosedBit) && (pos & ~ClosedBit) == DequeuePos;
+            }
+        };
+
+        const OverflowPolicy Policy;
+        /// Producers push here. Segments it left are retired through the EpochDomain
+        alignas(64) std::atomic<Segment *> Tail;
+        /// Consumer side
+        alignas(64) Segment *Head;
+
+        static std::size_t RoundCapacity(std::size_t capacity)
+        {
+            std::size_t rounded = 2;
+            while (rounded < capacity) rounded <<= 1;
+            return rounded;
+        }
+
+        static void DeleteSegment(void *segment) { delete static_cast<Segment *>(segment); }
+
+        /// Close the full segment, chain the next one and move Tail to it
+        Segment *Advance(Segment *segment)
+        {
+            Segment *next = segment->Next.load(std::memory_order_acquire);
+            if (next == nullptr)
+            {
+                segment->EnqueuePos.fetch_or(ClosedBit, std::memory_order_acq_rel);
+                auto *fresh = new Segment((segment->Mask + 1) * 2);
+                if (segment->Next.compare_exchange_strong(next, fresh, std::memory_order_acq_rel)) next = fresh;
+                else delete fresh;
+            }
+            Tail.compare_exchange_strong(segment, next, std::memory_order_acq_rel);
+            return next;
+        }
+
+    public:
+        /// \param capacity elements the first ring holds, rounded up to a power of two
+        /// \param policy what Push does when the ring is full
+        explicit MpscQueue(std::size_t capacity, OverflowPolicy policy)
+            : Policy(policy), Tail(new Segment(RoundCapacity(capacity))), Head(Tail.load(std::memory_order_relaxed)) {}
+        MpscQueue(const MpscQueue &) = delete;
+        MpscQueue &operator=(const MpscQueue &) = delete;
+
+        /// No thread may Push anymore. Remaining elements are destroyed
+        ~MpscQueue()
+        {
+            while (Head != nullptr)
+            {
+                Segment *next = Head->Next.load(std::memory_order_acquire);
+                delete Head;
+                Head = next;
+            }
+        }
+
+        /// Construct an element in place from any thread. Lock-free, allocation-free unless Grow chains a ring
+        /// \return false if the element was dropped (OverflowPolicy::Drop)
+        template<typename... P>
+        bool Push(P &&... args)
+        {
+            for (;;)
+            {
+                {
+                    EpochDomain::Guard guard(EpochDomain::Instance());
+                    Segment *segment = Tail.load(std::memory_order_acquire);
+                    for (;;)
+                    {
+                        const PushResult result = segment->Push(std::forward<P>(args)...);
+                        if (result == PushResult::Pushed) return true;
+                        if (result == PushResult::Closed || Policy == OverflowPolicy::Grow) segment = Advance(segment);
+                        else if (Policy == OverflowPolicy::Drop) return false;
+                        else break;
+                    }
+                }
+                // Block: wait outside of the critical section so segments can still be reclaimed
+                std::this_thread::yield();
+            }
+        }
+
+        /// Pop the oldest element and call f with it. Consumer thread only
+        /// \return false if nothing is ready
+        template<typename F>
+        bool Pop(F &&f)
+        {
+            for (;;)
+            {
+                if (Head->Pop(f)) return true;
+                if (!Head->Exhausted()) return false;
+                Segment *next = Head->Next.load(std::memory_order_acquire);
+                if (next == nullptr) return false;
+                Segment *previous = Head;
+                // Tail must not point to a retired segment
+                Tail.compare_exchange_strong(previous, next, std::memory_order_acq_rel);
+                EpochDomain::Instance().Retire(Head, &DeleteSegment);
+                Head = next;
+            }
+        }
+
+        /// Whether nothing is ready to be popped. Consumer thread only, producers may push meanwhile
+        [[nodiscard]] bool Empty() const
+        {
+            for (const Segment *segment = Head; segment != nullptr; segment = segment->Next.load(std::memory_order_acquire))
+            {
+                if (segment->Ready()) return false;
+            }
+            return true;
+        }
+    };
+
+    /// Multi-producer single-consumer queue attached to an Event. Any thread can Post without locking, the thread owning
+    /// the event drains the payloads through its normal listener list. Payloads live in a pre-allocated bounded ring.
+    /// \tparam Args event arguments, stored by value
+    /// \example ConcurrentEventQueue<int> healthQueue(OnPlayerHealthUpdate); healthQueue.Post(42); // worker thread
+    template<typename... Args>
+    class ConcurrentEventQueue
+    {
+    public:
+        /// A queued payload: arguments are stored by value
+        using Payload = std::tuple<std::decay_t<Args>...>;
+
+    private:
+        Event<Args...> &Target;
+        MpscQueue<Payload> Payloads;
+        bool IsDraining = false;
+
+    public:
+        /// \param event raised with every drained payload
+        /// \param capacity payloads the ring holds, rounded up to a power of two
+        /// \param policy what Post does when the ring is full
+        explicit ConcurrentEventQueue(Event<Args...> &event, std::size_t capacity = 1024, OverflowPolicy policy = OverflowPolicy::Block)
+            : Target(event), Payloads(capacity, policy) {}
+        ConcurrentEventQueue(const ConcurrentEventQueue &) = delete;
+        ConcurrentEventQueue &operator=(const ConcurrentEventQueue &) = delete;
+
+        /// Queue a payload from any thread. Lock-free, allocation-free unless the policy is Grow and the ring is full
+        /// \param args copied into the ring
+        /// \return false if the payload was dropped (OverflowPolicy::Drop)
+        [[maybe_unused]] bool Post(EventParamT<Args>... args)
+        {
+            return Payloads.Push(args...);
+        }
+
+        /// Queue a payload from any thread
+        [[maybe_unused]] inline bool operator()(EventParamT<Args>... args)
+        {
+            return Post(args...);
+        }
+
+        /// Raise the event with queued payloads, in post order per producer. Owner thread only.
+        /// Draining from a listener does nothing
+        /// \param maxPayloads stop after this many, so producers posting nonstop can't keep the owner thread here
+        /// \return dispatched payloads
+        [[maybe_unused]] std::size_t Drain(std::size_t maxPayloads = static_cast<std::size_t>(-1))
+        {
+            if (IsDraining) return 0;
+            IsDraining = true;
+            struct Reset
+            {
+                bool &Flag;
+                ~Reset() { Flag = false; }
+            } reset{IsDraining};
+
+            std::size_t count = 0;
+            while (count < maxPayloads && Payloads.Pop([this](Payload &&payload)
+            {
+                std::apply([this](auto &... args) { Target.Raise(args...); }, payload);
+            }))
+            {
+                ++count;
+            }
+            return count;
+        }
+
+        /// Whether nothing is ready to be drained. Owner thread only, producers may post meanwhile
+        [[maybe_unused]] [[nodiscard]] bool Empty() const { return Payloads.Empty(); }
+    };
+
+    /// Per-thread inbox. Listeners bound with an executor run on its thread: inline when the event is raised there,
+    /// otherwise the call and a copy of the arguments are pushed into the inbox, and run on the next RunPending.
+    /// \example Executor renderInbox; onMeshLoaded.Bind(&Renderer::Upload, &renderer, renderInbox); // render thread calls renderInbox.RunPending() every frame
+    class Executor
+    {
+    public:
+        /// Inline storage of a queued call, in bytes
+        static constexpr std::size_t TaskCapacity = 64;
+        /// Queued call. Captures up to TaskCapacity bytes never allocate, bigger ones are boxed on the heap
+        using Task = Delegate<void(), TaskCapacity>;
+
+    private:
+        std::atomic<std::thread::id> Owner;
+        MpscQueue<Task> Tasks;
+        bool IsRunning = false;
+
+    public:
+        /// The executor belongs to the constructing thread, see BindToCurrentThread
+        /// \param capacity tasks the inbox ring holds, rounded up to a power of two
+        /// \param policy what Post does when the inbox is full. Grow allocates only on overflow
+        explicit Executor(std::size_t capacity = 1024, OverflowPolicy policy = OverflowPolicy::Grow)
+            : Owner(std::this_thread::get_id()), Tasks(capacity, policy) {}
+        /// Listeners reference their executor, it can't be copied or moved
+        Executor(const Executor &) = delete;
+        Executor &operator=(const Executor &) = delete;
+
+        /// Make the calling thread the one running this inbox, e.g. when the executor is created before its thread
+        [[maybe_unused]] void BindToCurrentThread()
+        {
+            Owner.store(std::this_thread::get_id(), std::memory_order_release);
+        }
+
+        /// Whether the calling thread is the one running this inbox
+        [[maybe_unused]] [[nodiscard]] bool IsCurrent() const
+        {
+            return Owner.load(std::memory_order_acquire) == std::this_thread::get_id();
+        }
+
+        /// Queue a call from any thread. Lock-free, constructed in place in the inbox ring
+        /// \return false if the task was dropped (OverflowPolicy::Drop)
+        template<typename F>
+        [[maybe_unused]] bool Post(F &&task)
+        {
+            return Tasks.Push(std::forward<F>(task));
+        }
+
+        /// Run the queued calls, in post order per producer. Executor thread only, running from a task does nothing
+        /// \param maxTasks stop after this many
+        /// \return tasks run
+        [[maybe_unused]] std::size_t RunPending(std::size_t maxTasks = static_cast<std::size_t>(-1))
+        {
+            if (IsRunning) return 0;
+            IsRunning = true;
+            struct Reset
+            {
+                bool &Flag;
+                ~Reset() { Flag = false; }
+            } reset{IsRunning};
+
+            std::size_t count = 0;
+            while (count < maxTasks && Tasks.Pop([](Task &&task) { task(); })) ++count;
+            return count;
+        }
+
+        /// Whether nothing is waiting to run. Executor thread only
+        [[maybe_unused]] [[nodiscard]] bool Empty() const { return Tasks.Empty(); }
+    };
+
+    /// Wraps a listener so it runs on its executor's thread. Used by Bind(callback, owner, executor)
+    template<typename... Args>
+    struct ExecutorBinding
+    {
+        using Callback = Delegate<void(EventParamT<Args>...)>;
+
+        /// Shared by the bound listener and its queued calls. Removing the listener cancels the queued calls
+        struct State
+        {
+            Callback Function;
+            Executor &Target;
+            std::atomic<bool> Alive{true};
+
+            State(Callback function, Executor &target) : Function(std::move(function)), Target(target) {}
+        };
+
+        /// Call posted to the executor from another thread: the shared state and a copy of the arguments
+        struct QueuedCall
+        {
+            std::shared_ptr<State> Shared;
+            std::tuple<std::decay_t<Args>...> Payload;
+
+            void operator()() const
+            {
+                if (!Shared->Alive.load(std::memory_order_acquire)) return;
+                std::apply([this](const auto &... values) { Shared->Function(values...); }, Payload);
+            }
+        };
+
+        /// Bound in the event, fits in the listener's inline storage
+        struct Dispatcher
+        {
+            std::shared_ptr<State> Shared;
+
+            explicit Dispatcher(std::shared_ptr<State> shared) : Shared(std::move(shared)) {}
+            Dispatcher(Dispatcher &&) noexcept = default;
+            Dispatcher &operator=(Dispatcher &&) noexcept = default;
+
+            ~Dispatcher()
+            {
+                if (Shared) Shared->Alive.store(false, std::memory_order_release);
+            }
+
+            void operator()(EventParamT<Args>... args) const
+            {
+                if (Shared->Target.IsCurrent())
+                {
+                    Shared->Function(args...);
+                    return;
+                }
+                Shared->Target.Post(QueuedCall{Shared, std::tuple<std::decay_t<Args>...>(args...)});
+            }
+        };
+
+        /// Whether a call posted from another thread fits in the executor's inline task storage. Argument copies
+        /// up to Executor::TaskCapacity minus the shared state pointer (48 bytes on 64-bit targets) never allocate
+        static constexpr bool PostsInline = Executor::Task::FitsInline<QueuedCall>;
+
+        static Callback Wrap(Callback f, Executor &executor)
+        {
+            return Callback(Dispatcher(std::make_shared<State>(std::move(f), executor)));
+        }
+    };
+
+    /// Fork-join pool for Event::RaiseParallel. The calling thread takes part in the work.
+    /// Each participant owns a range of chunk indices, takes chunks from its front, and once empty steals half of
+    /// another range. Calls from a chunk, or while another thread is using the pool, run serially on the caller.
+    class ThreadPool
+    {
+    private:
+        using ChunkFunction = void (*)(void *, std::size_t);
+
+        /// Chunk indices [begin, end) of one participant, packed as begin << 32 | end
+        struct alignas(64) Range
+        {
+            std::atomic<std::uint64_t> Bounds{0};
+        };
+
+        std::vector<std::thread> Workers{};
+        /// One range per worker, plus the last one for the calling thread
+        std::unique_ptr<Range[]> Ranges;
+        std::mutex Mutex{};
+        std::condition_variable WorkReady{};
+        std::condition_variable WorkDone{};
+        std::uint64_t Generation = 0;
+        /// Workers inside the current ParallelFor
+        std::size_t Active = 0;
+        bool Stopping = false;
+        ChunkFunction Function = nullptr;
+        void *Context = nullptr;
+        std::exception_ptr Failure{};
+        std::atomic<std::size_t> Remaining{0};
+        std::atomic<bool> Busy{false};
+
+        static std::uint64_t Pack(std::uint64_t begin, std::uint64_t end) { return (begin << 32) | end; }
+
+        /// Take the first chunk of the participant's own range
+        bool PopOwn(std::size_t participant, std::size_t &chunk)
+        {
+            auto &bounds = Ranges[participant].Bounds;
+            std::uint64_t range = bounds.load(std::memory_order_acquire);
+            for (;;)
+            {
+                const std::uint64_t begin = range >> 32;
+                const std::uint64_t end = range & 0xFFFFFFFFu;
+                if (begin >= end) return false;
+                if (bounds.compare_exchange_weak(range, Pack(begin + 1, end), std::memory_order_acq_rel))
+                {
+                    chunk = static_cast<std::size_t>(begin);
+                    return true;
+                }
+            }
+        }
+
+        /// Steal the back half of another participant's range, keep its first chunk and make the rest our own range
+        bool Steal(std::size_t participant, std::size_t &chunk)
+        {
+            const std::size_t participants = Workers.size() + 1;
+            for (std::size_t offset = 1; offset < participants; ++offset)
+            {
+                auto &bounds = Ranges[(participant + offset) % participants].Bounds;
+                std::uint64_t range = bounds.load(std::memory_order_acquire);
+                for (;;)
+                {
+                    const std::uint64_t begin = range >> 32;
+                    const std::uint64_t end = range & 0xFFFFFFFFu;
+                    if (begin >= end) break;
+                    const std::uint64_t middle = begin + (end - begin) / 2;
+                    if (bounds.compare_exchange_weak(range, Pack(begin, middle), std::memory_order_acq_rel))
+                    {
+                        Ranges[participant].Bounds.store(Pack(middle + 1, end), std::memory_order_release);
+                        chunk = static_cast<std::size_t>(middle);
+                        return true;
+                    }
+                }
+            }
+            return false;
+        }
+
+        void Execute(std::size_t chunk)
+        {
+            try
+            {
+                Function(Context, chunk);
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(Mutex);
+                if (!Failure) Failure = std::current_exception();
+            }
+            Remaining.fetch_sub(1, std::memory_order_acq_rel);
+        }
+
+        /// Run chunks until none is left to take
+        void Participate(std::size_t participant)
+        {
+            std::size_t chunk = 0;
+            while (PopOwn(participant, chunk) || Steal(participant, chunk)) Execute(chunk);
+        }
+
+        void WorkerLoop(std::size_t participant)
+        {
+            std::uint64_t seen = 0;
+            std::unique_lock<std::mutex> lock(Mutex);
+            for (;;)
+            {
+                WorkReady.wait(lock, [&]() { return Stopping || Generation != seen; });
+                if (Stopping) return;
+                seen = Generation;
+                if (Function == nullptr) continue;
+                ++Active;
+                lock.unlock();
+                Participate(participant);
+                lock.lock();
+                if (--Active == 0) WorkDone.notify_all();
+            }
+        }
+
+    public:
+        /// \param threads worker threads, the calling thread always helps too. Defaults to one less than the hardware threads
+        explicit ThreadPool(std::size_t threads = DefaultThreads()) : Ranges(new Range[threads + 1])
+        {
+            Workers.reserve(threads);
+            for (std::size_t i = 0; i < threads; ++i) Workers.emplace_back([this, i]() { WorkerLoop(i); });
+        }
+
+        ThreadPool(const ThreadPool &) = delete;
+        ThreadPool &operator=(const ThreadPool &) = delete;
+
+        ~ThreadPool()
+        {
+            {
+                std::lock_guard<std::mutex> lock(Mutex);
+                Stopping = true;
+            }
+            WorkReady.notify_all();
+            for (auto &worker : Workers) worker.join();
+        }
+
+        [[nodiscard]] static std::size_t DefaultThreads()
+        {
+            const unsigned hardware = std::thread::hardware_concurrency();
+            return hardware > 1 ? hardware - 1 : 0;
+        }
+
+        /// Pool shared by every caller that doesn't bring its own
+        [[maybe_unused]] static ThreadPool &Shared()
+        {
+            static ThreadPool pool;
+            return pool;
+        }
+
+        /// Worker threads, the calling thread excluded
+        [[maybe_unused]] [[nodiscard]] std::size_t ThreadCount() const { return Workers.size(); }
+
+        /// Call chunk(i) for every i in [0, count) across the pool and return once all of them finished.
+        /// The first exception thrown by a chunk is rethrown here, after the join
+        /// \param count chunks to run
+        /// \param chunk called concurrently from several threads
+        template<typename F>
+        [[maybe_unused]] void ParallelFor(std::size_t count, F &&chunk)
+        {
+            assert(count <= 0xFFFFFFFFu && "Too many chunks");
+            if (count == 0) return;
+            if (Workers.empty() || count == 1 || Busy.exchange(true, std::memory_order_acquire))
+            {
+                for (std::size_t i = 0; i < count; ++i) chunk(i);
+                return;
+            }
+            struct Release
+            {
+                std::atomic<bool> &Flag;
+                ~Release() { Flag.store(false, std::memory_order_release); }
+            } release{Busy};
+
+            using Chunk = std::remove_reference_t<F>;
+            const std::size_t participants = Workers.size() + 1;
+            const std::size_t share = count / participants;
+            const std::size_t extra = count % participants;
+            std::size_t begin = 0;
+            for (std::size_t p = 0; p < participants; ++p)
+            {
+                const std::size_t end = begin + share + (p < extra ? 1 : 0);
+                Ranges[p].Bounds.store(Pack(begin, end), std::memory_order_relaxed);
+                begin = end;
+            }
+            Remaining.store(count, std::memory_order_relaxed);
+            {
+                std::lock_guard<std::mutex> lock(Mutex);
+                Context = const_cast<void *>(static_cast<const void *>(&chunk));
+                Function = [](void *context, std::size_t i) { (*static_cast<Chunk *>(context))(i); };
+                Failure = nullptr;
+                ++Generation;
+            }
+            WorkReady.notify_all();
+
+            Participate(participants - 1);
+            while (Remaining.load(std::memory_order_acquire) != 0) std::this_thread::yield();
+
+            std::exception_ptr failure;
+            {
+                std::unique_lock<std::mutex> lock(Mutex);
+                // Late workers see no job, the ranges can be reused by the next call once the active ones left
+                Function = nullptr;
+                WorkDone.wait(lock, [this]() { return Active == 0; });
+                failure = std::exchange(Failure, nullptr);
+            }
+            if (failure) std::rethrow_exception(failure);
+        }
+    };
+
+    /// Background thread running the tasks posted to it, in post order per producer. Sleeps while idle
+    class AsyncWorker
+    {
+    private:
+        MpscQueue<Executor::Task> Tasks;
+        std::mutex Mutex{};
+        std::condition_variable Wake{};
+        std::atomic<bool> Sleeping{false};
+        bool Stopping = false;
+        std::thread Thread;
+
+        void Loop()
+        {
+            for (;;)
+            {
+                while (Tasks.Pop([](Executor::Task &&task) { task(); })) {}
+
+                std::unique_lock<std::mutex> lock(Mutex);
+                if (Stopping)
+                {
+                    // Tasks posted between the drain above and the destructor setting Stopping
+                    lock.unlock();
+                    while (Tasks.Pop([](Executor::Task &&task) { task(); })) {}
+                    return;
+                }
+                Sleeping.store(true, std::memory_order_seq_cst);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                Wake.wait(lock, [this]() { return Stopping || !Tasks.Empty(); });
+                Sleeping.store(false, std::memory_order_relaxed);
+            }
+        }
+
+    public:
+        /// \param capacity tasks the ring holds before it grows, rounded up to a power of two
+        explicit AsyncWorker(std::size_t capacity = 1024)
+            : Tasks(capacity, OverflowPolicy::Grow), Thread([this]() { Loop(); }) {}
+        AsyncWorker(const AsyncWorker &) = delete;
+        AsyncWorker &operator=(const AsyncWorker &) = delete;
+
+        /// Runs the tasks already posted, then stops the thread
+        ~AsyncWorker()
+        {
+            {
+                std::lock_guard<std::mutex> lock(Mutex);
+                Stopping = true;
+            }
+            Wake.notify_one();
+            Thread.join();
+        }
+
+        /// Worker shared by every async listener bound without one
+        [[maybe_unused]] static AsyncWorker &Shared()
+        {
+            static AsyncWorker worker;
+            return worker;
+        }
+
+        /// Queue a task from any thread. Lock-free unless the worker sleeps and has to be woken up
+        template<typename F>
+        [[maybe_unused]] void Post(F &&task)
+        {
+            Tasks.Push(std::forward<F>(task));
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (Sleeping.load(std::memory_order_seq_cst))
+            {
+                std::lock_guard<std::mutex> lock(Mutex);
+                Wake.notify_one();
+            }
+        }
+    };
+
+    /// Completion of the async listeners of one AsyncEvent raise. Trivially copyable, must not outlive its event
+    class AsyncToken
+    {
+        template<typename... Args> friend class AsyncEvent;
+
+    private:
+        /// Pooled payload state: generation << 32 | async listener groups still running
+        const std::atomic<std::uint64_t> *State = nullptr;
+        std::uint64_t Generation = 0;
+
+        AsyncToken(const std::atomic<std::uint64_t> *state, std::uint64_t generation) : State(state), Generation(generation) {}
+
+    public:
+        /// A token of a raise without async listeners, always done
+        AsyncToken() = default;
+
+        /// Whether every async listener of the raise finished
+        [[maybe_unused]] [[nodiscard]] bool Done() const
+        {
+            if (State == nullptr) return true;
+            const std::uint64_t state = State->load(std::memory_order_acquire);
+            // The payload got recycled by a later raise, so this one is long done
+            return (state >> 32) != Generation || (state & 0xFFFFFFFFu) == 0;
+        }
+
+        /// Block until every async listener of the raise finished
+        [[maybe_unused]] void Wait() const
+        {
+            while (!Done()) std::this_thread::yield();
+        }
+    };
+
+    /// Event with fire-and-forget listeners. BindAsync listeners run on a background worker instead of the raising
+    /// thread: Raise copies the arguments once into pooled storage, shared read-only by every async listener of that
+    /// raise, posts one task per worker, then calls the regular listeners. Raise it from one thread at a time.
+    /// Async listeners must not throw. The event waits for its running async listeners when destroyed.
+    /// Only its own Raise schedules the async listeners, so it is not an Event&: it can't back an EventQueue,
+    /// a ConcurrentEventQueue or a Scheduler, and has no RaiseBatch, RaiseParallel or RaiseBudgeted
+    /// \tparam Args event arguments, copied for async listeners
+    /// \example AsyncEvent<SaveGame> onSave; onSave.BindAsync([](const SaveGame &save) {...}); onSave(save).Wait();
+    template<typename... Args>
+    class AsyncEvent : private Event<Args...>, public ConnectionTarget
+    {
+        using Base = Event<Args...>;
+
+    public:
+        using Callback = typename Base::Callback;
+        /// Arguments as stored for async listeners
+        using Payload = std::tuple<std::decay_t<Args>...>;
+
+    private:
+        struct AsyncListener
+        {
+            Callback Function;
+            void *Owner;
+            std::uint64_t Id;
+            /// Cleared on removal, queued calls skip the listener
+            std::atomic<bool> Alive{true};
+
+            AsyncListener(Callback function, void *owner, std::uint64_t id) : Function(std::move(function)), Owner(owner), Id(id) {}
+        };
+
+        /// Async listeners of one worker, in bind order. Immutable: rebuilt on every change, tasks keep theirs alive
+        struct Group
+        {
+            AsyncWorker *Worker;
+            std::vector<std::shared_ptr<AsyncListener>> Listeners;
+        };
+
+        /// Pooled payload storage, recycled once every group of its raise finished
+        struct Block
+        {
+            std::atomic<std::uint64_t> State{0};
+            alignas(Payload) unsigned char Storage[sizeof(Payload)];
+
+            Payload &Get() { return *std::launder(reinterpret_cast<Payload *>(Storage)); }
+        };
+
+        std::vector<std::shared_ptr<const Group>> Groups{};
+        /// Every block ever allocated, owned by the raising thread
+        std::vector<std::unique_ptr<Block>> Blocks{};
+        /// Blocks released by the workers, ready for the next raise
+        MpscQueue<Block *> FreeBlocks{64, OverflowPolicy::Grow};
+        /// Raises whose async listeners are still running
+        std::atomic<std::size_t> Outstanding{0};
+        std::uint64_t NextId = 1;
+
+        static void *StandaloneKey()
+        {
+            static void *StandaloneCallbackKey = reinterpret_cast<void *>(-1);
+            return StandaloneCallbackKey;
+        }
+
+        Block *AcquireBlock()
+        {
+            Block *block = nullptr;
+            if (FreeBlocks.Pop([&block](Block *&&free) { block = free; })) return block;
+            Blocks.push_back(std::make_unique<Block>());
+            return Blocks.back().get();
+        }
+
+        /// Called by each group once done with the payload. The last one destroys it and recycles the block
+        void ReleaseBlock(Block *block)
+        {
+            if ((block->State.fetch_sub(1, std::memory_order_acq_rel) & 0xFFFFFFFFu) != 1) return;
+            block->Get().~Payload();
+            FreeBlocks.Push(block);
+            Outstanding.fetch_sub(1, std::memory_order_release);
+        }
+
+        Connection InternalBindAsync(Callback f, void *const owner, AsyncWorker &worker)
+        {
+            const std::uint64_t id = NextId++;
+            auto listener = std::make_shared<AsyncListener>(std::move(f), owner, id);
+            auto found = std::find_if(Groups.begin(), Groups.end(), [&worker](const auto &group) { return group->Worker == &worker; });
+            auto group = std::make_shared<Group>(found != Groups.end() ? **found : Group{&worker, {}});
+            group->Listeners.push_back(std::move(listener));
+            if (found != Groups.end()) *found = std::move(group);
+            else Groups.push_back(std::move(group));
+            return Connection{this, static_cast<std::uint32_t>(id), static_cast<std::uint32_t>(id >> 32)};
+        }
+
+        /// Remove the async listeners matching the predicate, their queued calls are skipped
+        /// \return removed listeners
+        template<typename Pred>
+        std::size_t RemoveAsyncIf(Pred pred)
+        {
+            std::size_t removed = 0;
+            for (auto &group : Groups)
+            {
+                if (std::none_of(group->Listeners.begin(), group->Listeners.end(), [&pred](const auto &l) { return pred(*l); })) continue;
+                auto kept = std::make_shared<Group>(Group{group->Worker, {}});
+                for (const auto &listener : group->Listeners)
+                {
+                    if (!pred(*listener))
+                    {
+                        kept->Listeners.push_back(listener);
+                        continue;
+                    }
+                    listener->Alive.store(false, std::memory_order_release);
+                    ++removed;
+                }
+                group = std::move(kept);
+            }
+            Groups.erase(std::remove_if(Groups.begin(), Groups.end(), [](const auto &group) { return group->Listeners.empty(); }), Groups.end());
+            return removed;
+        }
+
+    public:
+        explicit AsyncEvent(const std::string &name = "") : Base(name) {}
+        /// Queued calls point to their event, so it can't be copied or moved
+        AsyncEvent(const AsyncEvent &) = delete;
+        AsyncEvent &operator=(const AsyncEvent &) = delete;
+
+        ~AsyncEvent()
+        {
+            WaitIdle();
+            // Drain the free list before the blocks it points to are destroyed
+            while (FreeBlocks.Pop([](Block *&&) {})) {}
+        }
+
+        /// Raise/Trigger this Event: schedule the async listeners, then call the regular ones
+        /// \param args copied once for every async listener, forwarded to the regular ones without copies
+        /// \return completion of the async listeners of this raise
+        [[maybe_unused]] AsyncToken Raise(EventParamT<Args>... args)
+        {
+            AsyncToken token;
+            if (!Groups.empty())
+            {
+                Block *block = AcquireBlock();
+                ::new(static_cast<void *>(block->Storage)) Payload(args...);
+                const std::uint64_t generation = (block->State.load(std::memory_order_relaxed) >> 32) + 1;
+                block->State.store((generation << 32) | Groups.size(), std::memory_order_relaxed);
+                Outstanding.fetch_add(1, std::memory_order_relaxed);
+                token = AsyncToken(&block->State, generation);
+                for (const auto &group : Groups)
+                {
+                    group->Worker->Post([this, group, block]()
+                    {
+                        const Payload &payload = block->Get();
+                        for (const auto &listener : group->Listeners)
+                        {
+                            if (!listener->Alive.load(std::memory_order_acquire)) continue;
+                            std::apply([&listener](const auto &... values) { listener->Function(values...); }, payload);
+                        }
+                        ReleaseBlock(block);
+                    });
+                }
+            }
+            Base::Raise(args...);
+            return token;
+        }
+
+        /// Raise/Trigger this Event. See Raise
+        inline AsyncToken operator()(EventParamT<Args>... args)
+        {
+            return Raise(args...);
+        }
+
+        /// Binds a callback run on a background worker on every raise
+        /// \param cb the callback function, receives the shared payload
+        /// \param worker thread running the callback
+        /// \return connection handle, use it to remove only this listener
+        /// \example event.BindAsync([](const Stats &stats) {...});
+        [[maybe_unused]] Connection BindAsync(Callback cb, AsyncWorker &worker = AsyncWorker::Shared())
+        {
+            return InternalBindAsync(std::move(cb), StandaloneKey(), worker);
+        }
+
+        /// Binds a callback related to the object, run on a background worker on every raise. Remove(object) removes it.
+        /// The object must stay alive until WaitIdle returns after its removal
+        /// \param f function reference
+        /// \param t object pointer
+        /// \param worker thread running the callback
+        /// \return connection handle, use it to remove only this listener
+        template<typename T>
+        [[maybe_unused]] Connection BindAsync(Callback f, T *const t, AsyncWorker &worker = AsyncWorker::Shared())
+        {
+            assert(t != nullptr && "Cannot bind to a null pointer");
+            return InternalBindAsync(std::move(f), t, worker);
+        }
+
+        /// Binds this object's function, run on a background worker on every raise. See BindAsync(f, t)
+        template<typename T>
+        [[maybe_unused]] Connection BindAsync(void(T::* const f)(Args...), T *const t, AsyncWorker &worker = AsyncWorker::Shared())
+        {
+            assert(t != nullptr && "Cannot bind to a null pointer");
+            return InternalBindAsync(Callback(t, f), t, worker);
+        }
+
+        /// Regular listeners, see Event
+        using Base::GetName;
+        using Base::GetBinder;
+        using Base::Bind;
+        using Base::BindOnce;
+#ifdef __cpp_lib_span
+        using Base::BindBatch;
+#endif
+#ifdef __cpp_lib_coroutine
+        using Base::Next;
+        using Base::Stream;
+#endif
+        using Base::Size;
+        using Base::CallbackCount;
+        using Base::Compact;
+        using Base::Cleanup;
+
+        /// Remove all references to the object pointer, regular and async. Queued async calls are skipped
+        /// \return true if we found and removed the object reference, false otherwise
+        template<typename T>
+        [[maybe_unused]] bool Remove(T *const t)
+        {
+            void *const key = t;
+            const bool removedAsync = RemoveAsyncIf([key](const AsyncListener &listener) { return listener.Owner == key; }) != 0;
+            const bool removed = Base::Remove(t);
+            return removedAsync || removed;
+        }
+
+        /// Remove all references to the object this weak ptr is pointing to, regular and async
+        /// \return true if we found and removed the object reference, false otherwise
+        template<typename T>
+        [[maybe_unused]] bool Remove(std::weak_ptr<T> ptr)
+        {
+            if (auto shared = ptr.lock()) return Remove(shared.get());
+            return false;
+        }
+
+        /// Remove all references to the object this ptr is pointing to, regular and async
+        /// \return true if we found and removed the object reference, false otherwise
+        template<typename T>
+        [[maybe_unused]] bool Remove(std::shared_ptr<T> ptr)
+        {
+            return ptr ? Remove(ptr.get()) : false;
+        }
+
+        /// Remove the listener referenced by this connection
+        [[maybe_unused]] bool Remove(Connection &connection)
+        {
+            return connection.Disconnect();
+        }
+
+        /// Clears all references from this event, regular and async
+        [[maybe_unused]] void RemoveAll()
+        {
+            RemoveAsyncIf([](const AsyncListener &) { return true; });
+            Base::RemoveAll();
+        }
+
+        /// Block until the async listeners of every raise so far finished. Must not be called from one
+        [[maybe_unused]] void WaitIdle() const
+        {
+            while (Outstanding.load(std::memory_order_acquire) != 0) std::this_thread::yield();
+        }
+
+        bool Disconnect(std::uint32_t slot, std::uint32_t generation) override
+        {
+            const std::uint64_t id = (static_cast<std::uint64_t>(generation) << 32) | slot;
+            return RemoveAsyncIf([id](const AsyncListener &listener) { return listener.Id == id; }) != 0;
+        }
+
+        [[nodiscard]] bool IsConnected(std::uint32_t slot, std::uint32_t generation) const override
+        {
+            const std::uint64_t id = (static_cast<std::uint64_t>(generation) << 32) | slot;
+            return std::any_of(Groups.begin(), Groups.end(), [id](const auto &group)
+            {
+                return std::any_of(group->Listeners.begin(), group->Listeners.end(), [id](const auto &l) { return l->Id == id; });
+            });
+        }
+
+        /// Async listeners bound to this event
+        [[maybe_unused]] [[nodiscard]] std::size_t AsyncCount() const
+        {
+            std::size_t count = 0;
+            for (const auto &group : Groups) count += group->Listeners.size();
+            return count;
+        }
+    };
+}
+
+#endif //SPARKLE_CONCURRENT_EVENT_H
\ No newline at end of file
@@ -2,14 +2,33 @@
 #define SPARKLE_EVENT_H
 
 #include <functional>
+#include <initializer_list>
 #include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
 #include <string>
+#include <tuple>
 #include <vector>
 #include <memory>
-#include <map>
+#include <unordered_map>
+#if __has_include(<version>)
+#include <version>
+#endif
+#ifdef __cpp_lib_span
+#include <span>
+#endif
+#ifdef __cpp_lib_coroutine
+#include <coroutine>
+#include <optional>
+#endif
 
-// TODO: Support Handle to remove specific functions instead of all functions of specific object
 // TODO: Improve performance of Raise function
 
 namespace Sparkle
@@ -29,108 +48,1249 @@ namespace Sparkle
         [[maybe_unused]] [[nodiscard]] inline const std::string &GetName() const { return Name; }
     };
 
+    /// Type-erased callable with inline small-buffer storage. Used by events to store every listener.
+    /// Holds lambdas, free functions, member function/object pairs and move-only callables behind a single
+    /// indirect call. Callables up to Capacity bytes are stored inline, bigger ones fall back to the heap.
+    /// \tparam Signature function signature, e.g. void(int)
+    /// \tparam Capacity inline storage size in bytes
+    template<typename Signature, std::size_t Capacity = 32>
+    class Delegate;
+
+    template<typename R, typename... A, std::size_t Capacity>
+    class Delegate<R(A...), Capacity>
+    {
+    private:
+        enum class Operation { Relocate, Destroy };
+        using Invoker = R (*)(void *, A...);
+        /// Relocates or destroys the stored callable. Null when the callable is trivially copyable and inline
+        using Manager = void (*)(Operation, void *destination, void *source);
+
+        alignas(std::max_align_t) unsigned char Storage[Capacity]{};
+        Invoker Invoke = nullptr;
+        Manager Manage = nullptr;
+
+        template<typename F>
+        static constexpr bool StoredInline = sizeof(F) <= Capacity && alignof(F) <= alignof(std::max_align_t)
+                                             && std::is_nothrow_move_constructible_v<F>;
+
+    public:
+        /// Whether a callable of type F is stored without allocating
+        template<typename F>
+        static constexpr bool FitsInline = StoredInline<F>;
+
+    private:
+
+        template<typename T, typename M>
+        struct MemberCall
+        {
+            T *Object;
+            M Method;
+
+            R operator()(A... args) const { return (Object->*Method)(std::forward<A>(args)...); }
+        };
+
+        template<typename F>
+        static R InvokeInline(void *storage, A... args)
+        {
+            auto &f = *std::launder(reinterpret_cast<F *>(storage));
+            if constexpr (std::is_void_v<R>) f(std::forward<A>(args)...);
+            else return f(std::forward<A>(args)...);
+        }
+
+        template<typename F>
+        static R InvokeHeap(void *storage, A... args)
+        {
+            auto &f = **reinterpret_cast<F **>(storage);
+            if constexpr (std::is_void_v<R>) f(std::forward<A>(args)...);
+            else return f(std::forward<A>(args)...);
+        }
+
+        template<auto Method, typename T>
+        static R InvokeMethod(void *storage, A... args)
+        {
+            T *object = *std::launder(reinterpret_cast<T **>(storage));
+            if constexpr (std::is_void_v<R>) std::invoke(Method, object, std::forward<A>(args)...);
+            else return std::invoke(Method, object, std::forward<A>(args)...);
+        }
+
+        template<typename F>
+        static void ManageInline(Operation operation, void *destination, void *source)
+        {
+            if (operation == Operation::Relocate)
+            {
+                auto *from = std::launder(reinterpret_cast<F *>(source));
+                ::new (destination) F(std::move(*from));
+                from->~F();
+            }
+            else
+            {
+                std::launder(reinterpret_cast<F *>(destination))->~F();
+            }
+        }
+
+        template<typename F>
+        static void ManageHeap(Operation operation, void *destination, void *source)
+        {
+            if (operation == Operation::Relocate)
+            {
+                std::memcpy(destination, source, sizeof(F *));
+            }
+            else
+            {
+                delete *reinterpret_cast<F **>(destination);
+            }
+        }
+
+        template<typename F>
+        void Emplace(F &&f)
+        {
+            using Stored = std::decay_t<F>;
+            if constexpr (StoredInline<Stored>)
+            {
+                ::new (static_cast<void *>(Storage)) Stored(std::forward<F>(f));
+                Invoke = &InvokeInline<Stored>;
+                Manage = std::is_trivially_copyable_v<Stored> ? nullptr : &ManageInline<Stored>;
+            }
+            else
+            {
+                ::new (static_cast<void *>(Storage)) Stored *(new Stored(std::forward<F>(f)));
+                Invoke = &InvokeHeap<Stored>;
+                Manage = &ManageHeap<Stored>;
+            }
+        }
+
+        void Reset()
+        {
+            if (Manage) Manage(Operation::Destroy, Storage, nullptr);
+            Invoke = nullptr;
+            Manage = nullptr;
+        }
+
+        void Take(Delegate &other)
+        {
+            if (other.Manage) other.Manage(Operation::Relocate, Storage, other.Storage);
+            else std::memcpy(Storage, other.Storage, Capacity);
+            Invoke = other.Invoke;
+            Manage = other.Manage;
+            other.Invoke = nullptr;
+            other.Manage = nullptr;
+        }
+
+    public:
+        Delegate() = default;
+
+        /// Store any callable invocable with this delegate signature
+        /// \param f lambda, functor or function pointer
+        template<typename F, typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, Delegate>
+                                                         && std::is_invocable_r_v<R, std::decay_t<F> &, A...>>>
+        Delegate(F &&f) // NOLINT(google-explicit-constructor) implicit on purpose, so lambdas bind directly
+        {
+            Emplace(std::forward<F>(f));
+        }
+
+        /// Store a member function/object pair. The object must outlive this delegate.
+        /// The method parameters only need to be callable with this delegate arguments
+        /// \param object object pointer
+        /// \param method member function to call on object
+        template<typename T, typename M, typename = std::enable_if_t<std::is_member_function_pointer_v<M>
+                                                                     && std::is_invocable_r_v<R, M, T *, A...>>>
+        Delegate(T *object, M method)
+        {
+            Emplace(MemberCall<T, M>{object, method});
+        }
+
+        /// Store an object pointer bound to a member function known at compile time.
+        /// The call is resolved inside a static thunk, so the compiler can inline the method. The object must outlive this delegate
+        /// \tparam Method member function pointer, e.g. &MyClass::Function
+        /// \param object object pointer
+        /// \example auto d = Delegate<void(int)>::FromMethod<&MyClass::Function>(&myClassObject);
+        template<auto Method, typename T>
+        [[nodiscard]] static Delegate FromMethod(T *object)
+        {
+            static_assert(std::is_invocable_r_v<R, decltype(Method), T *, A...>, "Method cannot be called with this delegate signature");
+            Delegate delegate;
+            ::new (static_cast<void *>(delegate.Storage)) T *(object);
+            delegate.Invoke = &InvokeMethod<Method, T>;
+            return delegate;
+        }
+
+        Delegate(Delegate &&other) noexcept { Take(other); }
+
+        Delegate &operator=(Delegate &&other) noexcept
+        {
+            if (this != &other)
+            {
+                Reset();
+                Take(other);
+            }
+            return *this;
+        }
+
+        Delegate(const Delegate &) = delete;
+        Delegate &operator=(const Delegate &) = delete;
+
+        ~Delegate() { Reset(); }
+
+        /// Does this delegate hold a callable?
+        [[nodiscard]] explicit operator bool() const { return Invoke != nullptr; }
+
+        /// Access the stored callable, like std::function::target
+        /// \tparam F stored callable type
+        /// \return the callable, or null if this delegate doesn't hold an F
+        template<typename F>
+        [[nodiscard]] const F *Target() const
+        {
+            if (Invoke == &InvokeInline<F>) return std::launder(reinterpret_cast<const F *>(Storage));
+            if (Invoke == &InvokeHeap<F>) return *reinterpret_cast<F *const *>(Storage);
+            return nullptr;
+        }
+
+        /// Call the stored callable. Calling an empty delegate is undefined
+        inline R operator()(A... args) const
+        {
+            assert(Invoke != nullptr && "Calling an empty delegate");
+            return Invoke(const_cast<unsigned char *>(Storage), std::forward<A>(args)...);
+        }
+    };
+
+    /// Anything a Connection can disconnect from. Internal use only
+    class ConnectionTarget
+    {
+    public:
+        /// Disconnect the listener stored at this slot, if the generation still matches
+        /// \return true if a listener was disconnected
+        virtual bool Disconnect(std::uint32_t slot, std::uint32_t generation) = 0;
+
+        /// Is the listener stored at this slot still connected with this generation?
+        [[nodiscard]] virtual bool IsConnected(std::uint32_t slot, std::uint32_t generation) const = 0;
+
+        /// The connection of the listener stored at this slot moved to this position of its Trackable owner.
+        /// Only targets binding Trackable owners need it
+        virtual void Retrack([[maybe_unused]] std::uint32_t slot, [[maybe_unused]] std::uint32_t position) {}
+
+    protected:
+        ~ConnectionTarget() = default;
+    };
+
+    /// Handle to a single bound listener, returned by every Bind/BindOnce.
+    /// It is a plain value (a pointer and two integers): copying it does not allocate and disconnecting is O(1).
+    /// Handles are generational, so using one after its listener was removed is safe and does nothing.
+    /// A connection must not be used after its event is destroyed.
+    class Connection
+    {
+        friend class Trackable;
+
+    private:
+        ConnectionTarget *Target = nullptr;
+        std::uint32_t Slot = 0;
+        std::uint32_t Generation = 0;
+
+    public:
+        Connection() = default;
+        Connection(ConnectionTarget *target, std::uint32_t slot, std::uint32_t generation)
+            : Target(target), Slot(slot), Generation(generation) {}
+
+        /// Remove this listener from its event. The handle is reset
+        /// \return true if the listener was still connected and got removed
+        [[maybe_unused]] bool Disconnect()
+        {
+            if (Target == nullptr) return false;
+            auto *target = Target;
+            Target = nullptr;
+            return target->Disconnect(Slot, Generation);
+        }
+
+        /// Is this listener still bound? False once disconnected, removed by owner, or after a BindOnce fired
+        [[maybe_unused]] [[nodiscard]] bool IsConnected() const
+        {
+            return Target != nullptr && Target->IsConnected(Slot, Generation);
+        }
+
+        /// Does this handle reference a listener? It might already be disconnected, see IsConnected
+        [[maybe_unused]] [[nodiscard]] explicit operator bool() const { return Target != nullptr; }
+    };
+
+    /// RAII Connection. Disconnects the listener when destroyed
+    /// \example ScopedConnection connection = event.Bind([]{...});
+    class ScopedConnection
+    {
+    private:
+        Connection Handle{};
+
+    public:
+        ScopedConnection() = default;
+        ScopedConnection(Connection connection) : Handle(connection) {} // NOLINT(google-explicit-constructor)
+        ScopedConnection(ScopedConnection &&other) noexcept : Handle(other.Release()) {}
+
+        ScopedConnection &operator=(ScopedConnection &&other) noexcept
+        {
+            if (this != &other)
+            {
+                Handle.Disconnect();
+                Handle = other.Release();
+            }
+            return *this;
+        }
+
+        ScopedConnection(const ScopedConnection &) = delete;
+        ScopedConnection &operator=(const ScopedConnection &) = delete;
+
+        ~ScopedConnection() { Handle.Disconnect(); }
+
+        /// Stop managing the connection without disconnecting it
+        /// \return the managed connection
+        [[maybe_unused]] Connection Release()
+        {
+            Connection released = Handle;
+            Handle = Connection{};
+            return released;
+        }
+
+        /// Disconnect now
+        /// \return true if the listener was still connected and got removed
+        [[maybe_unused]] bool Disconnect() { return Handle.Disconnect(); }
+
+        [[maybe_unused]] [[nodiscard]] bool IsConnected() const { return Handle.IsConnected(); }
+        [[maybe_unused]] [[nodiscard]] const Connection &Get() const { return Handle; }
+    };
+
+    /// Opt-in base for objects bound by raw pointer. Records every connection made to the object and disconnects them
+    /// all when it is destroyed, in O(number of connections). Binding such an object by raw pointer is then safe and,
+    /// unlike weak_ptr bindings, costs no liveness check on Raise. The object can live in plain arrays or pools, as long
+    /// as they don't relocate it once bound: listeners keep calling the address they were bound to.
+    /// \example struct HUD : Sparkle::Trackable { void ShowWeapon(int id); };
+    class Trackable
+    {
+        template<typename... Args> friend class EventBinder;
+
+    private:
+        /// Connection of every listener bound to this object. Each listener knows its position, so removal is O(1)
+        std::vector<Connection> Connections{};
+
+        /// Record the connection of a new listener
+        /// \return its position, kept by the listener for Untrack
+        std::uint32_t Track(Connection connection)
+        {
+            Connections.push_back(connection);
+            return static_cast<std::uint32_t>(Connections.size() - 1);
+        }
+
+        /// Forget the connection of this listener. Called by the event when the listener is removed.
+        /// The last connection fills the hole and its listener is told its new position
+        /// \param position position returned by Track, or by the last Retrack
+        void Untrack(const ConnectionTarget *target, std::uint32_t slot, std::uint32_t position)
+        {
+            // Already forgotten while DisconnectAll runs
+            if (position >= Connections.size() || Connections[position].Target != target || Connections[position].Slot != slot) return;
+            if (position + 1 != Connections.size())
+            {
+                Connection &moved = Connections[position];
+                moved = Connections.back();
+                moved.Target->Retrack(moved.Slot, position);
+            }
+            Connections.pop_back();
+        }
+
+    public:
+        Trackable() = default;
+        /// Connections belong to the object they were made to, copies start disconnected
+        Trackable(const Trackable &) : Connections() {}
+        Trackable &operator=(const Trackable &) { return *this; }
+        /// Listeners call the address they were bound to and can't be re-pointed, so a bound object can't be moved.
+        /// Containers relocating their elements (e.g. a growing std::vector) fall back to copies, which start disconnected:
+        /// keep bound objects in storage that doesn't relocate them, like a pool, a std::deque or a vector reserved upfront
+        Trackable(Trackable &&) = delete;
+        Trackable &operator=(Trackable &&) = delete;
+
+        ~Trackable() { DisconnectAll(); }
+
+        /// Remove this object from every event it is bound to
+        [[maybe_unused]] void DisconnectAll()
+        {
+            auto connections = std::move(Connections);
+            Connections.clear();
+            for (auto &connection : connections)
+            {
+                connection.Disconnect();
+            }
+        }
+
+        /// How many listeners are bound to this object
+        [[maybe_unused]] [[nodiscard]] std::size_t ConnectionCount() const { return Connections.size(); }
+    };
+
+    /// How an event argument is passed from Raise to every listener.
+    /// Arguments are never copied per listener: references are passed through, small trivially copyable
+    /// values are passed by value and everything else by const reference.
+    /// Specialize it to change the policy of a type.
+    /// \tparam T event argument type
+    /// \example template<> struct Sparkle::EventParam<Vector3> { using Type = Vector3; };
+    template<typename T, typename = void>
+    struct EventParam
+    {
+        using Type = std::conditional_t<std::is_trivially_copyable_v<T> && sizeof(T) <= 2 * sizeof(void *), T, const T &>;
+    };
+
+    template<typename T>
+    struct EventParam<T &> { using Type = T &; };
+
+    template<typename T>
+    struct EventParam<T &&> { using Type = const T &; };
+
+    template<typename T>
+    using EventParamT = typename EventParam<T>::Type;
+
+#ifdef __cpp_lib_span
+    /// Column of a batch raise: one contiguous span per event argument. Only mutable references get a mutable span
+    template<typename T>
+    using EventColumnT = std::span<std::conditional_t<std::is_lvalue_reference_v<T>, std::remove_reference_t<T>, const std::decay_t<T>>>;
+#endif
+
+    /// Propagation token of a ConsumableEvent. The listener that handles the event stops it, the remaining ones are skipped.
+    /// It can't be copied, listeners receive it by reference
+    class Propagation
+    {
+    private:
+        bool Stopped = false;
+
+    public:
+        Propagation() = default;
+        Propagation(const Propagation &) = delete;
+        Propagation &operator=(const Propagation &) = delete;
+
+        /// Mark the event as handled: no other listener is called by this Raise
+        [[maybe_unused]] void Stop() { Stopped = true; }
+
+        [[maybe_unused]] [[nodiscard]] bool IsStopped() const { return Stopped; }
+
+        /// Whether the event was handled, see IsStopped
+        [[maybe_unused]] [[nodiscard]] explicit operator bool() const { return Stopped; }
+    };
+
+    /// How a coroutine stores one event argument: by value. A ConsumableEvent Propagation token becomes whether a
+    /// listener handled the raise
+    template<typename T>
+    struct AwaitedValue
+    {
+        using Type = std::decay_t<T>;
+    };
+
+    template<>
+    struct AwaitedValue<Propagation &>
+    {
+        using Type = bool;
+    };
+
+    /// What a coroutine receives from one raise: the argument itself for single argument events, a tuple otherwise
+    template<typename... Args>
+    struct EventValue
+    {
+        using Type = std::tuple<typename AwaitedValue<Args>::Type...>;
+    };
+
+    template<typename A>
+    struct EventValue<A>
+    {
+        using Type = typename AwaitedValue<A>::Type;
+    };
+
+    template<typename... Args>
+    using EventValueT = typename EventValue<Args...>::Type;
+
+    /// Work a slice of a budgeted raise may do: a time span, a listener count, or both, whichever runs out first.
+    /// A slice always calls at least one listener, so every slice makes progress
+    /// \example event.RaiseBudgeted(std::chrono::milliseconds(2), chunk); event.RaiseBudgeted(RaiseBudget(64), chunk);
+    struct RaiseBudget
+    {
+        static constexpr std::size_t Unlimited = static_cast<std::size_t>(-1);
+
+        /// Time a slice may run, checked between listener calls
+        std::chrono::nanoseconds Time = std::chrono::nanoseconds::max();
+        /// Listeners a slice may call
+        std::size_t Listeners = Unlimited;
+
+        RaiseBudget() = default;
+
+        template<typename Rep, typename Period>
+        RaiseBudget(std::chrono::duration<Rep, Period> time, std::size_t listeners = Unlimited) // NOLINT(google-explicit-constructor)
+            : Time(std::chrono::duration_cast<std::chrono::nanoseconds>(time)), Listeners(listeners) {}
+
+        explicit RaiseBudget(std::size_t listeners) : Listeners(listeners) {}
+
+        [[maybe_unused]] [[nodiscard]] bool Timed() const { return Time != std::chrono::nanoseconds::max(); }
+    };
+
     template<typename... Args> class Event;
+    template<typename... Args> class EventQueue;
+    template<typename... Args> class BudgetedRaise;
+    class Executor;
+    template<typename... Args> struct ExecutorBinding;
+
+    template<typename... Args>
+    class EventBinder : public ConnectionTarget
+    {
+        friend Event<Args...>;
+        /// Registered Callback. Public
+        using Callback = Delegate<void(EventParamT<Args>...)>;
+
+        /// A bound callback and its lifecycle. Internal use only
+        struct Listener
+        {
+            Callback Function;
+            /// Owner liveness when bound through a weak or shared pointer
+            std::weak_ptr<const void> Tracker{};
+            /// Check Tracker before calling. Raw pointer and standalone bindings skip it
+            bool Tracked = false;
+            /// Removed, waiting for the storage to be compacted
+            bool Dead = false;
+            /// Once listener called by a Raise, its slot and owner index entry are given back when the Raise ends
+            bool Fired = false;
+            /// Function holds a BatchListener, column batches are handed to it in one call
+            bool Batch = false;
+            /// Safe to call concurrently with other parallel listeners, Event::RaiseParallel may run it on a pool
+            bool Parallel = false;
+            /// Owner deriving from Trackable, told when this listener is removed
+            Trackable *Observer = nullptr;
+            /// Position of this listener's connection in its Observer
+            std::uint32_t TrackIndex = 0;
+            /// Position of this listener's slot in the OwnerSlots entry of its owner
+            std::uint32_t OwnerIndex = 0;
+            /// Slot of this listener's Connection
+            std::uint32_t Slot = 0;
+            /// Higher priorities are called first
+            int Priority = 0;
+            /// Bind order across both lanes, breaks priority ties when they are merged
+            std::uint64_t Sequence = 0;
+        };
+
+        /// Generational slot. While in use Index is the listener position in its lane, while free it links the next free slot
+        struct Slot
+        {
+            std::uint32_t Index = 0;
+            std::uint32_t Generation = 0;
+            /// The listener lives in the once lane
+            bool Once = false;
+        };
+
+#ifdef __cpp_lib_span
+        /// Batch-aware callback: receives one span per argument and can vectorize over them. Public
+        using BatchCallback = Delegate<void(EventColumnT<Args>...)>;
+
+        /// Stored as a regular callback, single raises are forwarded as one element spans. Internal use only
+        struct BatchListener
+        {
+            BatchCallback Function;
+
+            void operator()(EventParamT<Args>... args) const
+            {
+                Function(EventColumnT<Args>(std::addressof(args), 1)...);
+            }
+        };
+#endif
+
+        static constexpr std::uint32_t NoSlot = ~std::uint32_t{0};
+        /// Dead listeners are compacted once they reach 1/CompactRatio of the storage
+        static constexpr std::size_t CompactRatio = 4;
+
+        /// Flat listener storage. Persistent and once listeners live in separate lanes, so raising never checks
+        /// whether a persistent listener should be removed and the once lane is cleared as a whole
+        struct Lane
+        {
+            /// Bound listeners, stored contiguously by descending priority then bind order, so Raise is a linear scan
+            std::vector<Listener> Listeners{};
+            /// Owner key of each listener. Parallel to Listeners (Owners[i] owns Listeners[i])
+            std::vector<void *> Owners{};
+            /// Listeners bound while raising and their owners. Appended to Listeners when the outermost Raise ends,
+            /// so the storage being iterated never reallocates. Their slot index already points past Listeners
+            std::vector<Listener> PendingListeners{};
+            std::vector<void *> PendingOwners{};
+            /// Listeners marked Dead (tombstones) still occupying storage. Raise skips them, Compact drops them
+            std::size_t DeadCount = 0;
+            /// Position where the next incremental Cleanup resumes. Kept in place by Compact
+            std::size_t CleanupCursor = 0;
+            /// Listeners were killed while raising, their callbacks are released once the outermost Raise ends
+            bool ReleasePending = false;
+
+            /// Listener at this position. Positions past the flat storage address listeners bound during a Raise
+            Listener &ListenerAt(std::size_t index)
+            {
+                return index < Listeners.size() ? Listeners[index] : PendingListeners[index - Listeners.size()];
+            }
+
+            [[nodiscard]] void *OwnerAt(std::size_t index) const
+            {
+                return index < Owners.size() ? Owners[index] : PendingOwners[index - Owners.size()];
+            }
+
+            /// Total positions, including listeners bound during a Raise
+            [[nodiscard]] std::size_t StoredCount() const
+            {
+                return Listeners.size() + PendingListeners.size();
+            }
+
+            [[nodiscard]] std::size_t LiveCount() const
+            {
+                return StoredCount() - DeadCount;
+            }
+
+            /// Insert the listener after every listener with the same or a higher priority.
+            /// Appending is the common case, otherwise the following listeners shift and their slots are updated
+            /// \param slots slot map, updated with the new positions
+            void Insert(Listener listener, void *const owner, std::vector<Slot> &slots)
+            {
+                std::size_t position = Listeners.size();
+                if (position != 0 && Listeners.back().Priority < listener.Priority)
+                {
+                    const int priority = listener.Priority;
+                    auto it = std::partition_point(Listeners.begin(), Listeners.end(),
+                                                   [priority](const Listener &l) { return l.Priority >= priority; });
+                    position = static_cast<std::size_t>(it - Listeners.begin());
+                    if (position < CleanupCursor) ++CleanupCursor;
+                }
+                Listeners.insert(Listeners.begin() + static_cast<std::ptrdiff_t>(position), std::move(listener));
+                Owners.insert(Owners.begin() + static_cast<std::ptrdiff_t>(position), owner);
+                for (std::size_t i = position; i < Listeners.size(); ++i)
+                {
+                    // Dead listeners already gave their slot back
+                    if (!Listeners[i].Dead) slots[Listeners[i].Slot].Index = static_cast<std::uint32_t>(i);
+                }
+            }
+
+            /// Insert the listeners bound during dispatch into the flat storage
+            void ApplyPending(std::vector<Slot> &slots)
+            {
+                if (PendingListeners.empty()) return;
+                for (std::size_t i = 0; i < PendingListeners.size(); ++i)
+                {
+                    Insert(std::move(PendingListeners[i]), PendingOwners[i], slots);
+                }
+                PendingListeners.clear();
+                PendingOwners.clear();
+            }
+
+            /// Drop every dead listener from the storage in a single pass, keeping the bind order of the remaining ones.
+            /// Live listeners are only moved once a dead one was found before them
+            /// \param slots slot map, updated with the new positions
+            void Compact(std::vector<Slot> &slots)
+            {
+                if (DeadCount == Listeners.size())
+                {
+                    // Fully dead, e.g. the once lane after a Raise
+                    Clear();
+                    return;
+                }
+                std::size_t write = 0;
+                std::size_t cursor = 0;
+                for (std::size_t read = 0; read < Listeners.size(); ++read)
+                {
+                    if (read == CleanupCursor) cursor = write;
+                    if (Listeners[read].Dead)
+                    {
+                        continue;
+                    }
+                    if (write != read)
+                    {
+                        Listeners[write] = std::move(Listeners[read]);
+                        Owners[write] = Owners[read];
+                        slots[Listeners[write].Slot].Index = static_cast<std::uint32_t>(write);
+                    }
+                    ++write;
+                }
+                if (CleanupCursor >= Listeners.size()) cursor = write;
+                CleanupCursor = cursor;
+                Listeners.resize(write);
+                Owners.resize(write);
+                DeadCount = 0;
+            }
+
+            /// Compact once at least 1/CompactRatio of the storage is dead, so the cost is amortized over the removals
+            void CompactIfNeeded(std::vector<Slot> &slots)
+            {
+                if (DeadCount != 0 && DeadCount * CompactRatio >= Listeners.size()) Compact(slots);
+            }
+
+            void Clear()
+            {
+                Listeners.clear();
+                Owners.clear();
+                PendingListeners.clear();
+                PendingOwners.clear();
+                DeadCount = 0;
+                CleanupCursor = 0;
+                ReleasePending = false;
+            }
+        };
+
+    private:
+        Lane Persistent{};
+        /// BindOnce listeners. Every one of them is removed by the next Raise
+        Lane Once{};
+        /// Secondary index: the connection slots of each owner. Keeps IsBound and Size O(1) and Remove(owner) O(owner listeners)
+        std::unordered_map<void *, std::vector<std::uint32_t>> OwnerSlots{};
+        /// Connection slot map. Slots are recycled through a free list, the generation invalidates stale handles
+        std::vector<Slot> Slots{};
+        std::uint32_t FreeSlot = NoSlot;
+        /// Sequence number of the next bound listener
+        std::uint64_t NextSequence = 0;
+        /// Raise calls currently on the stack. Storage is only appended to or compacted while it is zero
+        std::size_t RaiseDepth = 0;
+        /// Once listeners fired by the raises on the stack, their slots and owner index entries are not given back yet
+        std::size_t FiredCount = 0;
+
+        /// Tracks the Raise nesting depth and applies pending binds and removals once the outermost one ends, even on throw
+        class DispatchScope
+        {
+        private:
+            EventBinder &Binder;
+
+        public:
+            explicit DispatchScope(EventBinder &binder) : Binder(binder) { ++Binder.RaiseDepth; }
+            DispatchScope(const DispatchScope &) = delete;
+            DispatchScope &operator=(const DispatchScope &) = delete;
+
+            ~DispatchScope()
+            {
+                if (Binder.FiredCount != 0) Binder.ReleaseFired();
+                if (--Binder.RaiseDepth == 0) Binder.ApplyPending();
+            }
+        };
+
+        Lane &LaneOf(bool once) { return once ? Once : Persistent; }
+
+        /// Listener of a slot in use
+        Listener &ListenerOf(std::uint32_t slot) { return LaneOf(Slots[slot].Once).ListenerAt(Slots[slot].Index); }
+
+        /// Swap-remove the listener's slot from its owner's index entry. The slot must still be in use
+        /// \param slots index entry of the listener owner
+        void Unindex(std::vector<std::uint32_t> &slots, const Listener &listener)
+        {
+            const std::uint32_t moved = slots.back();
+            slots[listener.OwnerIndex] = moved;
+            ListenerOf(moved).OwnerIndex = listener.OwnerIndex;
+            slots.pop_back();
+        }
+
+        /// Intrusive list node of the coroutine awaiters and streams. Nodes live in the coroutine frame, never on the heap
+        struct WaitNode
+        {
+            WaitNode *Prev = nullptr;
+            WaitNode *Next = nullptr;
+            /// Hands the raise arguments to the node owner
+            void (*Notify)(WaitNode &, EventParamT<Args>...) = nullptr;
+
+            [[nodiscard]] bool Linked() const { return Next != nullptr; }
+
+            void Unlink()
+            {
+                if (!Linked()) return;
+                Prev->Next = Next;
+                Next->Prev = Prev;
+                Prev = nullptr;
+                Next = nullptr;
+            }
+        };
+
+        /// Sentinel of the coroutines waiting for the next raise. Each one is resumed once
+        WaitNode Waiters{&Waiters, &Waiters};
+        /// Sentinel of the streams, they buffer every raise
+        WaitNode Streams{&Streams, &Streams};
+
+        static void Link(WaitNode &list, WaitNode &node)
+        {
+            node.Prev = list.Prev;
+            node.Next = &list;
+            list.Prev->Next = &node;
+            list.Prev = &node;
+        }
+
+        [[nodiscard]] bool HasWaiters() const { return Waiters.Next != &Waiters || Streams.Next != &Streams; }
+
+        /// Buffer the raise in every stream, then resume the coroutines waiting for it.
+        /// Coroutines that wait again meanwhile are resumed by the next raise
+        void NotifyWaiters(EventParamT<Args>... args)
+        {
+            for (WaitNode *node = Streams.Next; node != &Streams; node = node->Next) node->Notify(*node, args...);
+            if (Waiters.Next == &Waiters) return;
+
+            // Detach the current waiters, a resumed coroutine may destroy any of them
+            struct Detached
+            {
+                WaitNode Sentinel{&Sentinel, &Sentinel};
+                WaitNode &Target;
+
+                explicit Detached(WaitNode &waiters) : Target(waiters)
+                {
+                    Sentinel.Next = waiters.Next;
+                    Sentinel.Prev = waiters.Prev;
+                    Sentinel.Next->Prev = &Sentinel;
+                    Sentinel.Prev->Next = &Sentinel;
+                    waiters.Next = &waiters;
+                    waiters.Prev = &waiters;
+                }
+
+                /// Give back the ones not resumed when a coroutine throws
+                ~Detached()
+                {
+                    while (Sentinel.Next != &Sentinel)
+                    {
+                        WaitNode *node = Sentinel.Next;
+                        node->Unlink();
+                        Link(Target, *node);
+                    }
+                }
+            } detached(Waiters);
+
+            while (detached.Sentinel.Next != &detached.Sentinel)
+            {
+                WaitNode *node = detached.Sentinel.Next;
+                node->Unlink();
+                node->Notify(*node, args...);
+            }
+        }
+
+        /// Release the listeners killed during dispatch, move the ones bound meanwhile into the flat storage, then compact if needed
+        void ApplyPending()
+        {
+            // A once lane with every listener fired or removed is dropped as a whole, its callbacks with it. Pending
+            // listeners count too: a stopped or budgeted Raise can leave live ones next to killed pending binds
+            if (Once.DeadCount != 0 && Once.DeadCount == Once.StoredCount()) Once.Clear();
+            for (Lane *lane : {&Persistent, &Once})
+            {
+                if (lane->ReleasePending) ReleaseDead(*lane);
+            }
+            Persistent.ApplyPending(Slots);
+            Once.ApplyPending(Slots);
+            CompactIfNeeded();
+        }
+
+        /// Bind a listener owned by a raw pointer. Trackable owners record the connection and remove it when destroyed
+        /// \param listener prepared listener
+        /// \param owner owner pointer
+        /// \param once bind to the once lane
+        /// \param priority higher priorities are called first
+        /// \return connection handle of the new listener
+        template<typename T>
+        Connection InternalBindRaw(Listener listener, T *const owner, bool once, int priority)
+        {
+            if constexpr (std::is_base_of_v<Trackable, T>)
+            {
+                Trackable *observer = owner;
+                listener.Observer = observer;
+                listener.TrackIndex = static_cast<std::uint32_t>(observer->ConnectionCount());
+                Connection connection = InternalBind(std::move(listener), owner, once, priority);
+                observer->Track(connection);
+                return connection;
+            }
+            else
+            {
+                return InternalBind(std::move(listener), owner, once, priority);
+            }
+        }
+
+        /// Complete the binding appending it to the flat listener storage of its lane
+        /// \param listener prepared listener
+        /// \param owner owner key
+        /// \param once bind to the once lane
+        /// \param priority higher priorities are called first
+        /// \return connection handle of the new listener
+        Connection InternalBind(Listener listener, void *const owner, bool once, int priority)
+        {
+            std::uint32_t slot = FreeSlot;
+            if (slot != NoSlot)
+            {
+                FreeSlot = Slots[slot].Index;
+            }
+            else
+            {
+                slot = static_cast<std::uint32_t>(Slots.size());
+                Slots.push_back(Slot{});
+            }
+            auto &lane = LaneOf(once);
+            Slots[slot].Once = once;
+            listener.Slot = slot;
+            listener.Priority = priority;
+            listener.Sequence = NextSequence++;
+            auto &owned = OwnerSlots[owner];
+            listener.OwnerIndex = static_cast<std::uint32_t>(owned.size());
+            owned.push_back(slot);
+            if (RaiseDepth == 0)
+            {
+                lane.Insert(std::move(listener), owner, Slots);
+            }
+            else
+            {
+                Slots[slot].Index = static_cast<std::uint32_t>(lane.StoredCount());
+                lane.PendingListeners.push_back(std::move(listener));
+                lane.PendingOwners.push_back(owner);
+            }
+            return Connection{this, slot, Slots[slot].Generation};
+        }
+
+        /// Mark the listener as removed: its owner, connection and callback are released immediately (the callback once the
+        /// outermost Raise ends when raising), the storage is compacted later
+        /// \param lane lane holding the listener
+        /// \param index listener position
+        void Kill(Lane &lane, std::size_t index)
+        {
+            auto &listener = lane.ListenerAt(index);
+            listener.Dead = true;
+            ++lane.DeadCount;
+
+            auto owned = OwnerSlots.find(lane.OwnerAt(index));
+            Unindex(owned->second, listener);
+            if (owned->second.empty()) OwnerSlots.erase(owned);
+
+            if (listener.Observer) listener.Observer->Untrack(this, listener.Slot, listener.TrackIndex);
+
+            auto &slot = Slots[listener.Slot];
+            ++slot.Generation;
+            slot.Index = FreeSlot;
+            FreeSlot = listener.Slot;
+
+            if (RaiseDepth == 0) Release(listener);
+            else lane.ReleasePending = true;
+        }
+
+        /// Remove a once listener right before Raise calls it, so nested raises skip it. Only the tombstone and the
+        /// generation are updated here: its slot and owner index entry are given back with the rest of the lane by ReleaseFired.
+        /// Must run inside a DispatchScope
+        /// \param index listener position in the once lane flat storage
+        void Fire(std::size_t index)
+        {
+            auto &listener = Once.Listeners[index];
+            listener.Dead = true;
+            listener.Fired = true;
+            ++Once.DeadCount;
+            ++FiredCount;
+            ++Slots[listener.Slot].Generation;
+            // The observer may be destroyed before the Raise ends
+            if (listener.Observer) listener.Observer->Untrack(this, listener.Slot, listener.TrackIndex);
+        }
+
+        /// Give back the slots and owner index entries of the fired once listeners in a single pass over the lane.
+        /// Consecutive listeners sharing an owner, like standalone callbacks, look its index entry up once.
+        /// Their callbacks are released when the outermost Raise ends, usually by clearing the whole lane
+        void ReleaseFired()
+        {
+            auto owned = OwnerSlots.end();
+            auto endRun = [this, &owned]()
+            {
+                if (owned != OwnerSlots.end() && owned->second.empty()) OwnerSlots.erase(owned);
+                owned = OwnerSlots.end();
+            };
+            for (std::size_t i = 0; i < Once.Listeners.size(); ++i)
+            {
+                auto &listener = Once.Listeners[i];
+                if (!listener.Fired) continue;
+                listener.Fired = false;
+                if (owned == OwnerSlots.end() || owned->first != Once.Owners[i])
+                {
+                    endRun();
+                    owned = OwnerSlots.find(Once.Owners[i]);
+                }
+                // Unindexed before the slot is freed, the moved index entry may point to a fired listener not released yet
+                Unindex(owned->second, listener);
+                Slots[listener.Slot].Index = FreeSlot;
+                FreeSlot = listener.Slot;
+            }
+            endRun();
+            FiredCount = 0;
+            Once.ReleasePending = true;
+        }
 
-    template<typename... Args>
-    class EventBinder
-    {
-        friend Event<Args...>;
-        /// Callback wrap. If returning true its active and should be kept. If false, it finished the lifecycle and should be removed from event. Internal use only
-        using LifecycleCallback = std::function<bool(Args...)>;
-        /// Registered Callback. Public
-        using Callback = std::function<void(Args...)>;
+        /// Destroy the callback and tracker of a dead listener, so captures are freed before the next compaction
+        static void Release(Listener &listener)
+        {
+            listener.Function = Callback{};
+            listener.Tracker.reset();
+        }
 
-    private:
-        std::unordered_map<void *, std::vector<LifecycleCallback>> Binds{};
+        /// Release the lane listeners killed during the Raise that just ended
+        static void ReleaseDead(Lane &lane)
+        {
+            for (std::size_t i = 0; i < lane.StoredCount(); ++i)
+            {
+                auto &listener = lane.ListenerAt(i);
+                if (listener.Dead && listener.Function) Release(listener);
+            }
+            lane.ReleasePending = false;
+        }
 
-        /// Complete the binding adding it to the Binds map
-        /// \tparam T object type
-        /// \param bound prepared lifecycle callback function
-        /// \param t object reference
-        template<typename T>
-        void InternalBind(LifecycleCallback bound, T *const t)
+        /// Kill every live listener of the lane matching the predicate
+        template<typename Pred>
+        void KillIf(Lane &lane, Pred pred)
+        {
+            for (std::size_t i = 0; i < lane.StoredCount(); ++i)
+            {
+                if (!lane.ListenerAt(i).Dead && pred(lane, i)) Kill(lane, i);
+            }
+        }
+
+        /// Drop every dead listener from the storage. Deferred to the end of the outermost Raise
+        void Compact()
+        {
+            if (RaiseDepth != 0) return;
+            if (Persistent.DeadCount != 0) Persistent.Compact(Slots);
+            if (Once.DeadCount != 0) Once.Compact(Slots);
+        }
+
+        void CompactIfNeeded()
+        {
+            if (RaiseDepth != 0) return;
+            Persistent.CompactIfNeeded(Slots);
+            Once.CompactIfNeeded(Slots);
+        }
+
+        /// Remove the lane listeners whose tracked owner expired, visiting at most maxVisits positions from its cursor
+        /// \return visited positions
+        std::size_t SweepExpired(Lane &lane, std::size_t maxVisits)
+        {
+            const std::size_t end = lane.StoredCount();
+            std::size_t visited = 0;
+            for (; lane.CleanupCursor < end && visited < maxVisits; ++lane.CleanupCursor, ++visited)
+            {
+                auto &listener = lane.ListenerAt(lane.CleanupCursor);
+                if (listener.Dead || !listener.Tracked || !listener.Tracker.expired()) continue;
+                Kill(lane, lane.CleanupCursor);
+            }
+            return visited;
+        }
+
+        /// Remove listeners whose tracked owner expired, visiting at most maxVisits positions from where the last sweep stopped
+        /// \param maxVisits listener positions to check
+        /// \return true if the sweep reached the last listener. The next one starts over from the first
+        bool SweepExpired(std::size_t maxVisits)
+        {
+            const std::size_t visited = SweepExpired(Persistent, maxVisits);
+            SweepExpired(Once, maxVisits - visited);
+            const bool finished = Persistent.CleanupCursor >= Persistent.StoredCount() && Once.CleanupCursor >= Once.StoredCount();
+            if (finished)
+            {
+                Persistent.CleanupCursor = 0;
+                Once.CleanupCursor = 0;
+            }
+            CompactIfNeeded();
+            return finished;
+        }
+
+        /// Call the listener unless its tracked owner expired
+        /// \return false if the tracked owner expired and the listener should be removed
+        static bool Dispatch(const Listener &listener, EventParamT<Args>... args)
         {
-            auto it = Binds.find(t);
-            if (it != Binds.end())
+            if (listener.Tracked)
             {
-                it->second.push_back(std::move(bound));
+                // Keep the owner alive for the duration of the call
+                auto keepAlive = listener.Tracker.lock();
+                if (!keepAlive) return false;
+                listener.Function(args...);
             }
             else
             {
-                Binds[t] = {std::move(bound)};
+                listener.Function(args...);
+            }
+            return true;
+        }
+
+        /// Call the listener of a connection, removing it first if it is a once listener, or after if its tracked owner expired.
+        /// Must run inside a DispatchScope
+        /// \return false if the connection was removed meanwhile and nothing was called
+        bool DispatchConnected(std::uint32_t slot, std::uint32_t generation, EventParamT<Args>... args)
+        {
+            if (!IsConnected(slot, generation)) return false;
+            auto &lane = LaneOf(Slots[slot].Once);
+            const std::size_t index = Slots[slot].Index;
+            auto &listener = lane.ListenerAt(index);
+            if (Slots[slot].Once)
+            {
+                Kill(lane, index);
+                Dispatch(listener, args...);
+            }
+            else if (!Dispatch(listener, args...) && !listener.Dead)
+            {
+                Kill(lane, index);
+            }
+            return true;
+        }
+
+        /// Call the listener for a batch of payloads, locking its tracked owner once for the whole batch.
+        /// Stops early if the listener gets removed meanwhile
+        /// \param count payloads to dispatch
+        /// \param call invoked as call(callback, payloadIndex)
+        /// \return false if the tracked owner expired and the listener should be removed
+        template<typename Call>
+        static bool DispatchBatch(const Listener &listener, std::size_t count, const Call &call)
+        {
+            std::shared_ptr<const void> keepAlive;
+            if (listener.Tracked)
+            {
+                keepAlive = listener.Tracker.lock();
+                if (!keepAlive) return false;
+            }
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                call(listener.Function, i);
+                if (listener.Dead) break;
+            }
+            return true;
+        }
+
+        /// Visit every live listener in dispatch order. Both lanes are sorted by priority then bind order, they are merged
+        /// the same way. The storage can't grow or move meanwhile: binds are queued and compaction waits for the outermost walk
+        /// \param visit called as visit(lane, index, std::bool_constant<once>), returns true to stop the walk
+        /// Dispatch order: higher priority first, then bind order
+        static bool RunsBefore(const Listener &a, const Listener &b)
+        {
+            return a.Priority != b.Priority ? a.Priority > b.Priority : a.Sequence < b.Sequence;
+        }
+
+        template<typename Visit>
+        void Walk(const Visit &visit)
+        {
+            DispatchScope scope(*this);
+            const std::size_t persistentCount = Persistent.Listeners.size();
+            const std::size_t onceCount = Once.Listeners.size();
+            std::size_t p = 0;
+            std::size_t o = 0;
+            while (p < persistentCount || o < onceCount)
+            {
+                if (o == onceCount || (p < persistentCount && RunsBefore(Persistent.Listeners[p], Once.Listeners[o])))
+                {
+                    const std::size_t i = p++;
+                    if (!Persistent.Listeners[i].Dead && visit(Persistent, i, std::false_type{})) return;
+                }
+                else
+                {
+                    const std::size_t i = o++;
+                    if (!Once.Listeners[i].Dead && visit(Once, i, std::true_type{})) return;
+                }
             }
         }
 
         template<typename T>
-        [[maybe_unused]] void Bind(Callback f, T *const t, bool bindOnce)
+        [[maybe_unused]] Connection Bind(Callback f, T *const t, bool bindOnce, int priority)
         {
             assert(t != nullptr && "Cannot bind to a null pointer");
-            auto bound = [f, t, bindOnce](Args... args) -> bool {
-                f(std::forward<Args>(args)...);
-                return !bindOnce;
-            };
-            InternalBind(bound, t);
+            return InternalBindRaw(Listener{std::move(f), {}, false}, t, bindOnce, priority);
         }
 
         template<typename T>
-        [[maybe_unused]] void Bind(Callback f, std::weak_ptr<T> weak, bool bindOnce)
+        [[maybe_unused]] Connection Bind(Callback f, std::weak_ptr<T> weak, bool bindOnce, int priority)
         {
             if (auto t = weak.lock())
             {
-                auto bound = [weak, f, bindOnce](Args... args) -> bool {
-                    if (!weak.expired()) {
-                        f(std::forward<Args>(args)...);
-                        return !bindOnce;
-                    }
-                    return false;
-                };
-                InternalBind(bound, t.get());
+                return InternalBind(Listener{std::move(f), std::move(weak), true}, t.get(), bindOnce, priority);
             }
+            return Connection{};
         }
 
         template<typename T>
-        [[maybe_unused]] void Bind(void(T::* const f)(Args...), std::weak_ptr<T> weak, bool bindOnce)
+        [[maybe_unused]] Connection Bind(void(T::* const f)(Args...), std::weak_ptr<T> weak, bool bindOnce, int priority)
         {
             if (auto t = weak.lock())
             {
-                auto bound = [weak, f, bindOnce](Args... args) -> bool {
-                    if (auto locked = weak.lock()) {
-                        (locked.get()->*f)(std::forward<Args>(args)...);
-                        return !bindOnce;
-                    }
-                    return false;
-                };
-                InternalBind(bound, t.get());
+                // The raw pointer is safe: Dispatch locks the tracker before every call
+                return InternalBind(Listener{Callback(t.get(), f), std::move(weak), true}, t.get(), bindOnce, priority);
             }
+            return Connection{};
         }
 
         template<typename T>
-        [[maybe_unused]] void Bind(void(T::* const f)(Args...), T *const t, bool bindOnce)
+        [[maybe_unused]] Connection Bind(void(T::* const f)(Args...), T *const t, bool bindOnce, int priority)
         {
             assert(t != nullptr && "Cannot bind to a null pointer");
-            auto bound = [t, f, bindOnce](Args... args) -> bool {
-                (t->*f)(std::forward<Args>(args)...);
-                return !bindOnce;
-            };
-            InternalBind(bound, t);
+            return InternalBindRaw(Listener{Callback(t, f), {}, false}, t, bindOnce, priority);
         }
 
-        [[maybe_unused]] void Bind(Callback cb, bool bindOnce)
+        template<auto Method, typename T>
+        [[maybe_unused]] Connection BindMethod(T *const t, bool bindOnce, int priority)
+        {
+            assert(t != nullptr && "Cannot bind to a null pointer");
+            return InternalBindRaw(Listener{Callback::template FromMethod<Method>(t), {}, false}, t, bindOnce, priority);
+        }
+
+        template<auto Method, typename T>
+        [[maybe_unused]] Connection BindMethod(std::weak_ptr<T> weak, bool bindOnce, int priority)
+        {
+            if (auto t = weak.lock())
+            {
+                return InternalBind(Listener{Callback::template FromMethod<Method>(t.get()), std::move(weak), true}, t.get(), bindOnce, priority);
+            }
+            return Connection{};
+        }
+
+        /// Owner key shared by every standalone callback
+        static void *StandaloneKey()
         {
-            auto bound = [cb, bindOnce](Args... args) -> bool {
-                cb(std::forward<Args>(args)...);
-                return !bindOnce;
-            };
             static void *StandaloneCallbackKey = reinterpret_cast<void *>(-1);
-            InternalBind(bound, StandaloneCallbackKey);
+            return StandaloneCallbackKey;
+        }
+
+        [[maybe_unused]] Connection Bind(Callback cb, bool bindOnce, int priority)
+        {
+            return InternalBind(Listener{std::move(cb), {}, false}, StandaloneKey(), bindOnce, priority);
         }
 
     public:
+        EventBinder() = default;
+        /// Connections point to their binder, so it can't be copied or moved
+        EventBinder(const EventBinder &) = delete;
+        EventBinder &operator=(const EventBinder &) = delete;
+
+        /// Trackable owners forget their connections to this event
+        ~EventBinder()
+        {
+            // Awaiting coroutines stay suspended, streams read as closed
+            for (WaitNode *list : {&Waiters, &Streams})
+            {
+                while (list->Next != list) list->Next->Unlink();
+            }
+            for (auto *lane : {&Persistent, &Once})
+            {
+                for (std::size_t i = 0; i < lane->StoredCount(); ++i)
+                {
+                    auto &listener = lane->ListenerAt(i);
+                    if (!listener.Dead && listener.Observer) listener.Observer->Untrack(this, listener.Slot, listener.TrackIndex);
+                }
+            }
+        }
 
-        /// Clears all references from this event
+        /// Clears all references from this event. While raising the listeners are only marked removed
         [[maybe_unused]] void RemoveAll()
         {
-            Binds.clear();
+            KillIf(Persistent, [](Lane &, std::size_t) { return true; });
+            KillIf(Once, [](Lane &, std::size_t) { return true; });
+            if (RaiseDepth != 0) return;
+            Persistent.Clear();
+            Once.Clear();
+            OwnerSlots.clear();
+        }
+
+        /// Remove the listener referenced by this connection
+        /// \param connection handle returned by Bind
+        /// \return true if the listener was still connected and got removed
+        [[maybe_unused]] bool Remove(Connection &connection)
+        {
+            return connection.Disconnect();
+        }
+
+        bool Disconnect(std::uint32_t slot, std::uint32_t generation) override
+        {
+            if (!IsConnected(slot, generation)) return false;
+            Kill(LaneOf(Slots[slot].Once), Slots[slot].Index);
+            // Compacting here keeps Bind/Disconnect churn bounded on events that are rarely raised. Kill itself can't,
+            // Remove and the sweeps call it while walking the lane and compact when done
+            CompactIfNeeded();
+            return true;
+        }
+
+        [[nodiscard]] bool IsConnected(std::uint32_t slot, std::uint32_t generation) const override
+        {
+            return slot < Slots.size() && Slots[slot].Generation == generation;
+        }
+
+        void Retrack(std::uint32_t slot, std::uint32_t position) override
+        {
+            ListenerOf(slot).TrackIndex = position;
         }
 
         /// Is this object pointer bounded as observer with any function to this event?
@@ -141,7 +1301,7 @@ namespace Sparkle
         [[maybe_unused]] [[nodiscard]] bool IsBound(T *t) const
         {
             assert(t != nullptr && "Cannot check bind of a null pointer");
-            return Binds.find(t) != Binds.end();
+            return OwnerSlots.find(t) != OwnerSlots.end();
         }
 
         /// Is this pointer bounded as observer with any function to this event?
@@ -178,11 +1338,13 @@ namespace Sparkle
         /// \tparam T object type
         /// \param f function reference
         /// \param t object pointer
+        /// \param priority higher priorities are called first, equal ones in bind order
+        /// \return connection handle, use it to remove only this listener
         /// \example event.Bind([]{...}, &reference);
         template<typename T>
-        [[maybe_unused]] void BindOnce(Callback f, T *const t)
+        [[maybe_unused]] Connection BindOnce(Callback f, T *const t, int priority = 0)
         {
-            Bind(f, t, true);
+            return Bind(std::move(f), t, true, priority);
         }
 
         /// Binds this function to the event related to the object
@@ -191,11 +1353,13 @@ namespace Sparkle
         /// \tparam T object type
         /// \param f function reference
         /// \param t object pointer
+        /// \param priority higher priorities are called first, equal ones in bind order
+        /// \return connection handle, use it to remove only this listener
         /// \example event.Bind([]{...}, &reference);
         template<typename T>
-        [[maybe_unused]] void Bind(Callback f, T *const t)
+        [[maybe_unused]] Connection Bind(Callback f, T *const t, int priority = 0)
         {
-            Bind(f, t, false);
+            return Bind(std::move(f), t, false, priority);
         }
 
         /// Converts the shared pointer to a weak pointer and binds this function to the event related to the object.
@@ -205,11 +1369,13 @@ namespace Sparkle
         /// \tparam T object type
         /// \param f function reference
         /// \param weak weak pointer to the object
+        /// \param priority higher priorities are called first, equal ones in bind order
+        /// \return connection handle, use it to remove only this listener
         /// \example event.Bind([]{...}, weak_ptr);
         template<typename T>
-        [[maybe_unused]] void BindOnce(Callback f, std::shared_ptr<T> shared)
+        [[maybe_unused]] Connection BindOnce(Callback f, std::shared_ptr<T> shared, int priority = 0)
         {
-            BindOnce(f, std::weak_ptr<T>(shared), true);
+            return Bind(std::move(f), std::weak_ptr<T>(shared), true, priority);
         }
 
         /// Binds this function to the event related to the object. The function will be called only on the next time the event is raised
@@ -218,11 +1384,13 @@ namespace Sparkle
         /// \tparam T object type
         /// \param f function reference
         /// \param weak weak pointer to the object
+        /// \param priority higher priorities are called first, equal ones in bind order
+        /// \return connection handle, use it to remove only this listener
         /// \example event.Bind([]{...}, weak_ptr);
         template<typename T>
-        [[maybe_unused]] void BindOnce(Callback f, std::weak_ptr<T> weak)
+        [[maybe_unused]] Connection BindOnce(Callback f, std::weak_ptr<T> weak, int priority = 0)
         {
-            Bind(f, weak, true);
+            return Bind(std::move(f), weak, true, priority);
         }
 
         /// Converts the shared pointer to a weak pointer and binds this function to the event related to the object
@@ -231,11 +1399,13 @@ namespace Sparkle
         /// \tparam T object type
         /// \param f function reference
         /// \param weak weak pointer to the object
+        /// \param priority higher priorities are called first, equal ones in bind order
+        /// \return connection handle, use it to remove only this listener
         /// \example event.Bind([]{...}, weak_ptr);
         template<typename T>
-        [[maybe_unused]] void Bind(Callback f, std::shared_ptr<T> shared)
+        [[maybe_unused]] Connection Bind(Callback f, std::shared_ptr<T> shared, int priority = 0)
         {
-            Bind(f, std::weak_ptr<T>(shared), false);
+            return Bind(std::move(f), std::weak_ptr<T>(shared), false, priority);
         }
 
         /// Binds this function to the event related to the object
@@ -244,11 +1414,13 @@ namespace Sparkle
         /// \tparam T object type
         /// \param f function reference
         /// \param weak weak pointer to the object
+        /// \param priority higher priorities are called first, equal ones in bind order
+        /// \return connection handle, use it to remove only this listener
         /// \example event.Bind([]{...}, weak_ptr);
         template<typename T>
-        [[maybe_unused]] void Bind(Callback f, std::weak_ptr<T> weak)
+        [[maybe_unused]] Connection Bind(Callback f, std::weak_ptr<T> weak, int priority = 0)
         {
-            Bind(f, weak, false);
+            return Bind(std::move(f), weak, false, priority);
         }
 
         /// Converts the shared pointer to a weak pointer and binds this object's function to the event.
@@ -258,11 +1430,13 @@ namespace Sparkle
         /// \tparam T object type
         /// \param f function reference
         /// \param weak weak pointer to the object
+        /// \param priority higher priorities are called first, equal ones in bind order
+        /// \return connection handle, use it to remove only this listener
         /// \example event.Bind(&MyClass::Function, weak_ptr);
         template<typename T>
-        [[maybe_unused]] void BindOnce(void(T::* const f)(Args...), std::shared_ptr<T> shared)
+        [[maybe_unused]] Connection BindOnce(void(T::* const f)(Args...), std::shared_ptr<T> shared, int priority = 0)
         {
-            Bind(f, std::weak_ptr<T>(shared), true);
+            return Bind(f, std::weak_ptr<T>(shared), true, priority);
         }
 
         /// Binds this object's function to the event. The function will be called only on the next time the event is raised
@@ -271,11 +1445,13 @@ namespace Sparkle
         /// \tparam T object type
         /// \param f function reference
         /// \param weak weak pointer to the object
+        /// \param priority higher priorities are called first, equal ones in bind order
+        /// \return connection handle, use it to remove only this listener
         /// \example event.Bind(&MyClass::Function, weak_ptr);
         template<typename T>
-        [[maybe_unused]] void BindOnce(void(T::* const f)(Args...), std::weak_ptr<T> weak)
+        [[maybe_unused]] Connection BindOnce(void(T::* const f)(Args...), std::weak_ptr<T> weak, int priority = 0)
         {
-            Bind(f, weak, true);
+            return Bind(f, weak, true, priority);
         }
 
         /// Converts the shared pointer to a weak pointer and binds this object's function to the event.
@@ -284,11 +1460,13 @@ namespace Sparkle
         /// \tparam T object type
         /// \param f function reference
         /// \param weak weak pointer to the object
+        /// \param priority higher priorities are called first, equal ones in bind order
+        /// \return connection handle, use it to remove only this listener
         /// \example event.Bind(&MyClass::Function, weak_ptr);
         template<typename T>
-        [[maybe_unused]] void Bind(void(T::* const f)(Args...), std::shared_ptr<T> shared)
+        [[maybe_unused]] Connection Bind(void(T::* const f)(Args...), std::shared_ptr<T> shared, int priority = 0)
         {
-            Bind(f, std::weak_ptr<T>(shared), false);
+            return Bind(f, std::weak_ptr<T>(shared), false, priority);
         }
 
         /// Binds this object's function to the event.
@@ -297,58 +1475,451 @@ namespace Sparkle
         /// \tparam T object type
         /// \param f function reference
         /// \param weak weak pointer to the object
+        /// \param priority higher priorities are called first, equal ones in bind order
+        /// \return connection handle, use it to remove only this listener
         /// \example event.Bind(&MyClass::Function, weak_ptr);
         template<typename T>
-        [[maybe_unused]] void Bind(void(T::* const f)(Args...), std::weak_ptr<T> weak)
+        [[maybe_unused]] Connection Bind(void(T::* const f)(Args...), std::weak_ptr<T> weak, int priority = 0)
         {
-            Bind(f, weak, false);
+            return Bind(f, weak, false, priority);
         }
 
         /// Binds this object's function to the event. The function will be called only on the next time the event is raised
         /// The object will call the function and both must be valid (t->*f(...))
-        /// If the object expires before this Event does, it will have undefined behavior.
+        /// If the object expires before this Event does, it will have undefined behavior, unless T derives from Trackable.
         /// \tparam T object type
         /// \param f function reference
         /// \param t object pointer
+        /// \param priority higher priorities are called first, equal ones in bind order
+        /// \return connection handle, use it to remove only this listener
         /// \example event.Bind(&MyClass::Function, &myClassObject);
         template<typename T>
-        [[maybe_unused]] void BindOnce(void(T::* const f)(Args...), T * const t)
+        [[maybe_unused]] Connection BindOnce(void(T::* const f)(Args...), T * const t, int priority = 0)
         {
-            Bind(f, t, true);
+            return Bind(f, t, true, priority);
         }
 
         /// Binds this object's function to the event.
         /// The object will call the function and both must be valid (t->*f(...))
-        /// If the object expires before this Event does, it will have undefined behavior.
+        /// If the object expires before this Event does, it will have undefined behavior, unless T derives from Trackable.
         /// \tparam T object type
         /// \param f function reference
         /// \param t object pointer
+        /// \param priority higher priorities are called first, equal ones in bind order
+        /// \return connection handle, use it to remove only this listener
         /// \example event.Bind(&MyClass::Function, &myClassObject);
         template<typename T>
-        [[maybe_unused]]void Bind(void(T::* const f)(Args...), T * const t)
+        [[maybe_unused]] Connection Bind(void(T::* const f)(Args...), T * const t, int priority = 0)
+        {
+            return Bind(f, t, false, priority);
+        }
+
+        /// Binds this callback to run on the executor's thread: inline when raised there, otherwise queued into the executor.
+        /// Removing the listener cancels its queued calls. Requires Sparkle/ConcurrentEvent.h
+        /// \param f function reference
+        /// \param t object pointer
+        /// \param executor inbox of the thread the callback must run on
+        /// \param priority higher priorities are called first, equal ones in bind order
+        /// \return connection handle, use it to remove only this listener
+        /// \example event.Bind([]{...}, &reference, renderInbox);
+        template<typename T>
+        [[maybe_unused]] Connection Bind(Callback f, T *const t, Executor &executor, int priority = 0)
+        {
+            return Bind(ExecutorBinding<Args...>::Wrap(std::move(f), executor), t, false, priority);
+        }
+
+        /// Binds this object's function to run on the executor's thread: inline when raised there, otherwise queued into the executor.
+        /// Removing the listener cancels its queued calls. Requires Sparkle/ConcurrentEvent.h
+        /// \param f function reference
+        /// \param t object pointer
+        /// \param executor inbox of the thread the function must run on
+        /// \param priority higher priorities are called first, equal ones in bind order
+        /// \return connection handle, use it to remove only this listener
+        /// \example event.Bind(&MyClass::Function, &myClassObject, renderInbox);
+        template<typename T>
+        [[maybe_unused]] Connection Bind(void(T::* const f)(Args...), T *const t, Executor &executor, int priority = 0)
+        {
+            return Bind(Callback(t, f), t, executor, priority);
+        }
+
+        /// Binds this callback to this Event. The function will be called only on the next time the event is raised
+        /// Note that this doesn't require a pointer or handler, so this Event might throw an exception if the callback
+        /// lifetime expires before this Event does.
+        /// \param cb the callback function
+        /// \param priority higher priorities are called first, equal ones in bind order
+        /// \return connection handle, use it to remove only this listener
+        /// \example event.Bind([]{...});
+        [[maybe_unused]] Connection BindOnce(Callback cb, int priority = 0)
+        {
+            return Bind(std::move(cb), true, priority);
+        }
+
+        /// Binds this callback to this Event
+        /// Note that this doesn't require a pointer or handler, so this Event might throw an exception if the callback
+        /// lifetime expires before this Event does.
+        /// \param cb the callback function
+        /// \param priority higher priorities are called first, equal ones in bind order
+        /// \return connection handle, use it to remove only this listener
+        /// \example event.Bind([]{...});
+        [[maybe_unused]] Connection Bind(Callback cb, int priority = 0)
+        {
+            return Bind(std::move(cb), false, priority);
+        }
+
+        /// Binds this object's member function to the event, resolving the function at compile time.
+        /// Faster than Bind(&MyClass::Function, ...): the call is a static thunk the compiler can inline.
+        /// If the object expires before this Event does, it will have undefined behavior, unless T derives from Trackable.
+        /// \tparam Method member function pointer
+        /// \tparam T object type
+        /// \param t object pointer
+        /// \param priority higher priorities are called first, equal ones in bind order
+        /// \return connection handle, use it to remove only this listener
+        /// \example event.Bind<&MyClass::Function>(&myClassObject);
+        template<auto Method, typename T>
+        [[maybe_unused]] Connection Bind(T *const t, int priority = 0)
+        {
+            return BindMethod<Method>(t, false, priority);
+        }
+
+        /// Binds this object's member function to the event, resolving the function at compile time.
+        /// The function will be called only on the next time the event is raised.
+        /// If the object expires before this Event does, it will have undefined behavior, unless T derives from Trackable.
+        /// \tparam Method member function pointer
+        /// \tparam T object type
+        /// \param t object pointer
+        /// \param priority higher priorities are called first, equal ones in bind order
+        /// \return connection handle, use it to remove only this listener
+        /// \example event.BindOnce<&MyClass::Function>(&myClassObject);
+        template<auto Method, typename T>
+        [[maybe_unused]] Connection BindOnce(T *const t, int priority = 0)
+        {
+            return BindMethod<Method>(t, true, priority);
+        }
+
+        /// Binds this object's member function to the event, resolving the function at compile time.
+        /// If the object expires before this Event does, all references to the object will be removed from this event on next Event Raise
+        /// \tparam Method member function pointer
+        /// \tparam T object type
+        /// \param weak weak pointer to the object
+        /// \param priority higher priorities are called first, equal ones in bind order
+        /// \return connection handle, use it to remove only this listener
+        /// \example event.Bind<&MyClass::Function>(weak_ptr);
+        template<auto Method, typename T>
+        [[maybe_unused]] Connection Bind(std::weak_ptr<T> weak, int priority = 0)
+        {
+            return BindMethod<Method>(std::move(weak), false, priority);
+        }
+
+        /// Binds this object's member function to the event, resolving the function at compile time.
+        /// The function will be called only on the next time the event is raised.
+        /// If the object expires before this Event does, all references to the object will be removed from this event on next Event Raise
+        /// \tparam Method member function pointer
+        /// \tparam T object type
+        /// \param weak weak pointer to the object
+        /// \param priority higher priorities are called first, equal ones in bind order
+        /// \return connection handle, use it to remove only this listener
+        /// \example event.BindOnce<&MyClass::Function>(weak_ptr);
+        template<auto Method, typename T>
+        [[maybe_unused]] Connection BindOnce(std::weak_ptr<T> weak, int priority = 0)
+        {
+            return BindMethod<Method>(std::move(weak), true, priority);
+        }
+
+        /// Converts the shared pointer to a weak pointer and binds this object's member function to the event,
+        /// resolving the function at compile time.
+        /// \tparam Method member function pointer
+        /// \tparam T object type
+        /// \param shared shared pointer to the object
+        /// \param priority higher priorities are called first, equal ones in bind order
+        /// \return connection handle, use it to remove only this listener
+        /// \example event.Bind<&MyClass::Function>(shared_ptr);
+        template<auto Method, typename T>
+        [[maybe_unused]] Connection Bind(std::shared_ptr<T> shared, int priority = 0)
+        {
+            return BindMethod<Method>(std::weak_ptr<T>(shared), false, priority);
+        }
+
+        /// Converts the shared pointer to a weak pointer and binds this object's member function to the event,
+        /// resolving the function at compile time. The function will be called only on the next time the event is raised.
+        /// \tparam Method member function pointer
+        /// \tparam T object type
+        /// \param shared shared pointer to the object
+        /// \param priority higher priorities are called first, equal ones in bind order
+        /// \return connection handle, use it to remove only this listener
+        /// \example event.BindOnce<&MyClass::Function>(shared_ptr);
+        template<auto Method, typename T>
+        [[maybe_unused]] Connection BindOnce(std::shared_ptr<T> shared, int priority = 0)
+        {
+            return BindMethod<Method>(std::weak_ptr<T>(shared), true, priority);
+        }
+
+#ifdef __cpp_lib_span
+        /// Binds a batch-aware callback. Event::RaiseBatch with one span per argument calls it once for the whole batch,
+        /// any other raise calls it with one element spans.
+        /// \param cb the callback, receives one span per event argument
+        /// \param priority higher priorities are called first, equal ones in bind order
+        /// \return connection handle, use it to remove only this listener
+        /// \example event.BindBatch([](std::span<const float> damage) {...});
+        [[maybe_unused]] Connection BindBatch(BatchCallback cb, int priority = 0)
+        {
+            Listener listener{Callback(BatchListener{std::move(cb)}), {}, false};
+            listener.Batch = true;
+            return InternalBind(std::move(listener), StandaloneKey(), false, priority);
+        }
+
+        /// Binds a batch-aware callback related to the object. See BindBatch(cb)
+        /// \tparam T object type
+        /// \param cb the callback, receives one span per event argument
+        /// \param t object pointer
+        /// \param priority higher priorities are called first, equal ones in bind order
+        /// \return connection handle, use it to remove only this listener
+        /// \example event.BindBatch([](std::span<const float> damage) {...}, &reference);
+        template<typename T>
+        [[maybe_unused]] Connection BindBatch(BatchCallback cb, T *const t, int priority = 0)
+        {
+            assert(t != nullptr && "Cannot bind to a null pointer");
+            Listener listener{Callback(BatchListener{std::move(cb)}), {}, false};
+            listener.Batch = true;
+            return InternalBindRaw(std::move(listener), t, false, priority);
+        }
+#endif
+
+        /// Binds a callback that is safe to call concurrently with other parallel listeners. Event::RaiseParallel
+        /// runs consecutive parallel listeners in chunks on a thread pool, any other raise calls it normally.
+        /// It must not Bind, Remove or Raise this event.
+        /// \param cb the callback function
+        /// \param priority higher priorities are called first, equal ones in bind order
+        /// \return connection handle, use it to remove only this listener
+        /// \example event.BindParallel([](float alarm) {...});
+        [[maybe_unused]] Connection BindParallel(Callback cb, int priority = 0)
+        {
+            Listener listener{std::move(cb), {}, false};
+            listener.Parallel = true;
+            return InternalBind(std::move(listener), StandaloneKey(), false, priority);
+        }
+
+        /// Binds a parallel-safe callback related to the object. See BindParallel(cb)
+        /// \tparam T object type
+        /// \param cb the callback function
+        /// \param t object pointer
+        /// \param priority higher priorities are called first, equal ones in bind order
+        /// \return connection handle, use it to remove only this listener
+        /// \example event.BindParallel([](float alarm) {...}, &reference);
+        template<typename T>
+        [[maybe_unused]] Connection BindParallel(Callback cb, T *const t, int priority = 0)
+        {
+            assert(t != nullptr && "Cannot bind to a null pointer");
+            Listener listener{std::move(cb), {}, false};
+            listener.Parallel = true;
+            return InternalBindRaw(std::move(listener), t, false, priority);
+        }
+
+        /// Binds this object's parallel-safe function to the event. See BindParallel(cb)
+        /// \tparam T object type
+        /// \param f member function
+        /// \param t object pointer
+        /// \param priority higher priorities are called first, equal ones in bind order
+        /// \return connection handle, use it to remove only this listener
+        /// \example event.BindParallel(&Agent::OnAlarm, &agent);
+        template<typename T>
+        [[maybe_unused]] Connection BindParallel(void(T::* const f)(Args...), T *const t, int priority = 0)
+        {
+            return BindParallel(Callback(t, f), t, priority);
+        }
+
+        /// Binds this object's parallel-safe member function to the event, resolving the function at compile time.
+        /// See BindParallel(cb)
+        /// \tparam Method member function pointer
+        /// \tparam T object type
+        /// \param t object pointer
+        /// \param priority higher priorities are called first, equal ones in bind order
+        /// \return connection handle, use it to remove only this listener
+        /// \example event.BindParallel<&Agent::OnAlarm>(&agent);
+        template<auto Method, typename T>
+        [[maybe_unused]] Connection BindParallel(T *const t, int priority = 0)
         {
-            Bind(f, t, false);
+            return BindParallel(Callback::template FromMethod<Method>(t), t, priority);
         }
 
-        /// Binds this callback to this Event. The function will be called only on the next time the event is raised
-        /// Note that this doesn't require a pointer or handler, so this Event might throw an exception if the callback
-        /// lifetime expires before this Event does.
-        /// \param cb the callback function
-        /// \example event.Bind([]{...});
-        [[maybe_unused]]void BindOnce(Callback cb)
-        {
-            Bind(cb, true);
-        }
+#ifdef __cpp_lib_coroutine
+        /// Awaiter of the next raise, see Next(). Lives in the awaiting coroutine frame
+        class NextAwaiter : private WaitNode
+        {
+            friend EventBinder;
+
+        private:
+            EventBinder &Binder;
+            std::coroutine_handle<> Handle{};
+            std::optional<EventValueT<Args...>> Result{};
+
+            static void Wake(WaitNode &node, [[maybe_unused]] EventParamT<Args>... args)
+            {
+                auto &self = static_cast<NextAwaiter &>(node);
+                if constexpr (sizeof...(Args) != 0) self.Result.emplace(args...);
+                self.Handle.resume();
+            }
+
+        public:
+            explicit NextAwaiter(EventBinder &binder) : Binder(binder) { this->Notify = &Wake; }
+            NextAwaiter(const NextAwaiter &) = delete;
+            NextAwaiter &operator=(const NextAwaiter &) = delete;
+            ~NextAwaiter() { this->Unlink(); }
+
+            [[nodiscard]] bool await_ready() const noexcept { return false; }
+
+            void await_suspend(std::coroutine_handle<> handle)
+            {
+                Handle = handle;
+                Link(Binder.Waiters, *this);
+            }
+
+            /// \return the raise arguments: nothing, the argument itself, or a tuple of them
+            auto await_resume()
+            {
+                if constexpr (sizeof...(Args) != 0) return std::move(*Result);
+            }
+        };
+
+        /// Bounded buffer of raises read by a coroutine, see Stream(capacity).
+        /// When full, further raises are dropped for this stream and counted until the coroutine catches up.
+        /// The stream is closed by Close() or when the event is destroyed; reading a closed stream gives the buffered
+        /// raises, then nullopt
+        class EventStream
+        {
+        public:
+            using Value = EventValueT<Args...>;
+
+        private:
+            /// Linked in the event streams, buffers every raise
+            struct Buffering : WaitNode
+            {
+                EventStream *Owner = nullptr;
+            };
+
+            /// Linked in the event waiters while the coroutine waits for a raise
+            struct Waiting : WaitNode
+            {
+                EventStream *Owner = nullptr;
+            };
+
+            EventBinder &Binder;
+            Buffering Member{};
+            Waiting Reader{};
+            std::vector<std::optional<Value>> Ring;
+            std::size_t Head = 0;
+            std::size_t Count = 0;
+            std::size_t DroppedCount = 0;
+            std::coroutine_handle<> Handle{};
+
+            static void Push(WaitNode &node, [[maybe_unused]] EventParamT<Args>... args)
+            {
+                EventStream &self = *static_cast<Buffering &>(node).Owner;
+                if (self.Count == self.Ring.size())
+                {
+                    ++self.DroppedCount;
+                    return;
+                }
+                self.Ring[(self.Head + self.Count) % self.Ring.size()].emplace(args...);
+                ++self.Count;
+            }
+
+            static void Wake(WaitNode &node, EventParamT<Args>...)
+            {
+                std::exchange(static_cast<Waiting &>(node).Owner->Handle, {}).resume();
+            }
+
+            std::optional<Value> Pop()
+            {
+                if (Count == 0) return std::nullopt;
+                std::optional<Value> value = std::move(Ring[Head]);
+                Ring[Head].reset();
+                Head = (Head + 1) % Ring.size();
+                --Count;
+                return value;
+            }
+
+        public:
+            /// \param binder event to read
+            /// \param capacity raises buffered before dropping, allocated once
+            EventStream(EventBinder &binder, std::size_t capacity) : Binder(binder), Ring(capacity)
+            {
+                assert(capacity != 0 && "Stream capacity must be greater than zero");
+                Member.Owner = this;
+                Member.Notify = &Push;
+                Reader.Owner = this;
+                Reader.Notify = &Wake;
+                Link(Binder.Streams, Member);
+            }
+
+            /// Streams are linked into their event by address, they can't be copied or moved
+            EventStream(const EventStream &) = delete;
+            EventStream &operator=(const EventStream &) = delete;
+
+            ~EventStream()
+            {
+                Member.Unlink();
+                Reader.Unlink();
+            }
+
+            /// Awaiter of the next buffered raise
+            class Awaiter
+            {
+            private:
+                EventStream &Stream;
+
+            public:
+                explicit Awaiter(EventStream &stream) : Stream(stream) {}
+
+                [[nodiscard]] bool await_ready() const noexcept { return Stream.Count != 0 || Stream.Closed(); }
+
+                void await_suspend(std::coroutine_handle<> handle)
+                {
+                    Stream.Handle = handle;
+                    Link(Stream.Binder.Waiters, Stream.Reader);
+                }
+
+                /// \return the oldest buffered raise, nullopt once the stream is closed and empty
+                std::optional<Value> await_resume() { return Stream.Pop(); }
+            };
+
+            /// Wait for the next raise, or take the oldest buffered one
+            /// \example while (auto hit = co_await stream.Next()) {...}
+            [[nodiscard]] Awaiter Next() { return Awaiter(*this); }
+
+            /// Stop buffering. A coroutine waiting on the stream is resumed with nullopt
+            [[maybe_unused]] void Close()
+            {
+                Member.Unlink();
+                if (!Reader.Linked()) return;
+                Reader.Unlink();
+                std::exchange(Handle, {}).resume();
+            }
+
+            [[maybe_unused]] [[nodiscard]] bool Closed() const { return !Member.Linked(); }
+
+            /// Buffered raises not read yet
+            [[maybe_unused]] [[nodiscard]] std::size_t Size() const { return Count; }
+
+            [[maybe_unused]] [[nodiscard]] std::size_t Capacity() const { return Ring.size(); }
+
+            /// Raises dropped because the stream was full
+            [[maybe_unused]] [[nodiscard]] std::size_t Dropped() const { return DroppedCount; }
+        };
+
+        /// Suspend the awaiting coroutine until the next Raise, which resumes it with the arguments once its listeners ran.
+        /// Every raise path counts: EventQueue::Flush and RaiseBatch deliver one raise per payload, a ConsumableEvent
+        /// raise delivers whether a listener handled it in place of the Propagation token.
+        /// The awaiter is linked into the event intrusively, waiting doesn't allocate
+        /// \return awaiter, co_await it
+        /// \example auto damage = co_await onDamage.Next();
+        [[nodiscard]] NextAwaiter Next() { return NextAwaiter(*this); }
 
-        /// Binds this callback to this Event
-        /// Note that this doesn't require a pointer or handler, so this Event might throw an exception if the callback
-        /// lifetime expires before this Event does.
-        /// \param cb the callback function
-        /// \example event.Bind([]{...});
-        [[maybe_unused]]void Bind(Callback cb)
-        {
-            Bind(cb, false);
-        }
+        /// Open a bounded stream buffering every Raise from now on, read by a coroutine through Next(). See Next() for the raise paths
+        /// \param capacity raises buffered before dropping
+        /// \return stream, keep it in the coroutine frame
+        /// \example auto hits = onHit.Stream(16); while (auto hit = co_await hits.Next()) {...}
+        [[nodiscard]] EventStream Stream(std::size_t capacity) { return EventStream(*this, capacity); }
+#endif
 
         /// Remove all references to the object pointer
         /// \tparam T object type
@@ -358,14 +1929,21 @@ namespace Sparkle
         [[maybe_unused]]bool Remove(T * const t)
         {
             assert(t != nullptr && "Cannot remove a null pointer");
-            auto it = Binds.find(t);
-            bool removed = false;
-            if (it != Binds.end())
+            auto owned = OwnerSlots.find(t);
+            if (owned == OwnerSlots.end())
+            {
+                return false;
+            }
+            // Kill erases the index entry with its last slot. Once listeners fired by the current Raise stay indexed until it ends
+            const std::vector<std::uint32_t> slots = owned->second;
+            for (const std::uint32_t slot : slots)
             {
-                Binds.erase(it);
-                removed = true;
+                auto &lane = LaneOf(Slots[slot].Once);
+                const std::size_t index = Slots[slot].Index;
+                if (!lane.ListenerAt(index).Dead) Kill(lane, index);
             }
-            return removed;
+            CompactIfNeeded();
+            return true;
         }
 
         /// Remove all references to the object this weak ptr is pointing to
@@ -401,8 +1979,79 @@ namespace Sparkle
     template<typename... Args>
     class Event : public EventBase
     {
+        friend EventQueue<Args...>;
+        friend BudgetedRaise<Args...>;
+
     private:
         EventBinder<Args...> Binder{};
+        /// Parallel listeners per chunk in RaiseParallel
+        std::size_t ParallelGrain = 64;
+
+        /// Call the parallel listeners of the persistent lane in [begin, end), chunked on the pool when there are enough.
+        /// Workers only read the storage. BindParallel takes no weak owners, so there is no tracker to lock or expire
+        template<typename Pool>
+        void DispatchParallel(Pool &pool, std::size_t begin, std::size_t end, EventParamT<Args>... args)
+        {
+            auto& lane = Binder.Persistent;
+            const std::size_t count = end - begin;
+            if (count < 2 * ParallelGrain)
+            {
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    const auto& listener = lane.Listeners[i];
+                    if (!listener.Dead) listener.Function(args...);
+                }
+                return;
+            }
+
+            const std::size_t grain = ParallelGrain;
+            pool.ParallelFor((count + grain - 1) / grain, [&](std::size_t chunk)
+            {
+                const std::size_t first = begin + chunk * grain;
+                const std::size_t last = std::min(first + grain, end);
+                for (std::size_t i = first; i < last; ++i)
+                {
+                    const auto& listener = lane.Listeners[i];
+                    if (!listener.Dead) listener.Function(args...);
+                }
+            });
+        }
+
+        /// Run a slice of a budgeted raise: call its still connected listeners from its cursor on until the budget is spent.
+        /// Coroutines awaiting this event are resumed by the slice reaching the end
+        /// \return true once every listener of the raise was visited
+        bool ResumeBudgeted(BudgetedRaise<Args...> &raise, const RaiseBudget &budget)
+        {
+            using Clock = std::chrono::steady_clock;
+            const bool timed = budget.Timed();
+            const Clock::time_point deadline = timed ? Clock::now() + budget.Time : Clock::time_point::max();
+            std::size_t called = 0;
+            {
+                typename EventBinder<Args...>::DispatchScope scope(Binder);
+                while (raise.Cursor < raise.Entries.size())
+                {
+                    const auto entry = raise.Entries[raise.Cursor];
+                    if (!Binder.IsConnected(entry.Slot, entry.Generation))
+                    {
+                        ++raise.Cursor;
+                        continue;
+                    }
+                    if (called != 0 && (called >= budget.Listeners || (timed && Clock::now() >= deadline))) return false;
+                    // Moved past before the call, a throwing listener isn't called again by the next slice
+                    ++raise.Cursor;
+                    ++called;
+                    std::apply([this, &entry](auto&... values)
+                    {
+                        Binder.DispatchConnected(entry.Slot, entry.Generation, values...);
+                    }, raise.Payload);
+                }
+            }
+            if (Binder.HasWaiters())
+            {
+                std::apply([this](auto&... values) { Binder.NotifyWaiters(values...); }, raise.Payload);
+            }
+            return true;
+        }
 
     public:
         explicit Event(const std::string& name = "") : EventBase(name) {}
@@ -412,96 +2061,765 @@ namespace Sparkle
         inline EventBinder<Args...>& GetBinder() { return Binder; }
 
         /// Raise/Trigger this Event
-        /// \param args
-        inline void operator()(Args... args)
+        /// \param args forwarded to every listener without copies (see EventParam)
+        inline void operator()(EventParamT<Args>... args)
         {
-            Raise(std::forward<Args>(args)...);
+            Raise(args...);
         }
 
         /// Raise/Trigger this Event
-        /// \param args
-        [[maybe_unused]] void Raise([[maybe_unused]] Args... args)
+        /// Listeners may Bind, Remove and Raise this event again. Listeners bound meanwhile are first called on the next Raise,
+        /// removed ones are not called anymore, not even by the Raise in progress.
+        /// Coroutines awaiting this event (Next, Stream) are resumed after the listeners.
+        /// \param args forwarded to every listener without copies (see EventParam)
+        [[maybe_unused]] void Raise([[maybe_unused]] EventParamT<Args>... args)
+        {
+            RaiseUntil([]() { return false; }, args...);
+            if (Binder.HasWaiters()) Binder.NotifyWaiters(args...);
+        }
+
+        /// Raise/Trigger this Event, fanning parallel listeners (BindParallel) out on the pool.
+        /// Listeners keep their priority order: each run of consecutive parallel listeners is split in chunks of
+        /// SetParallelGrain listeners and joined before the next listener runs. Short runs stay on the calling thread.
+        /// \tparam Pool provides ParallelFor(chunkCount, chunk) calling chunk(i) for every i and returning once all are done,
+        /// e.g. Sparkle::ThreadPool from Sparkle/ConcurrentEvent.h
+        /// \param pool runs the chunks
+        /// \param args forwarded to every listener without copies (see EventParam)
+        /// \example event.RaiseParallel(ThreadPool::Shared(), alarmLevel);
+        template<typename Pool>
+        [[maybe_unused]] void RaiseParallel(Pool &pool, EventParamT<Args>... args)
         {
-            for (auto it = Binder.Binds.begin(); it != Binder.Binds.end(); )
+            // Parallel listeners are collected as an index range of the persistent lane, dispatched when the run ends.
+            // The scope keeps the storage in place until the last run is dispatched
+            typename EventBinder<Args...>::DispatchScope scope(Binder);
+            std::size_t runBegin = 0;
+            std::size_t runEnd = 0;
+            auto flush = [&]()
+            {
+                if (runBegin != runEnd) DispatchParallel(pool, runBegin, runEnd, args...);
+                runBegin = runEnd;
+            };
+            Binder.Walk([&](auto& lane, std::size_t i, auto once)
             {
-                auto& functionVector = it->second;
-                functionVector.erase(std::remove_if(functionVector.begin(), functionVector.end(), [&](const auto& cb)
+                auto& listener = lane.Listeners[i];
+                if constexpr (!decltype(once)::value)
+                {
+                    if (listener.Parallel)
+                    {
+                        if (runBegin == runEnd) runBegin = i;
+                        runEnd = i + 1;
+                        return false;
+                    }
+                }
+                flush();
+                if constexpr (decltype(once)::value)
+                {
+                    Binder.Fire(i);
+                    Binder.Dispatch(listener, args...);
+                }
+                else if (!Binder.Dispatch(listener, args...) && !listener.Dead)
                 {
-                    return !cb(std::forward<Args>(args)...);
-                }), functionVector.end());
+                    Binder.Kill(lane, i);
+                }
+                return false;
+            });
+            flush();
+            if (Binder.HasWaiters()) Binder.NotifyWaiters(args...);
+        }
+
+        /// Raise/Trigger this Event in slices: call listeners until the budget is spent, and resume the remaining ones from
+        /// the returned continuation, e.g. on the next frames. The arguments are copied once, into the continuation.
+        /// Listeners are called in Raise order. The listeners are the ones bound when this is called: listeners bound later are
+        /// not part of it, listeners removed before their turn are skipped, once listeners fired by another Raise meanwhile too.
+        /// Coroutines awaiting this event are resumed by the slice calling the last listener
+        /// \param budget time and/or listener count of this first slice
+        /// \param args copied into the continuation
+        /// \return continuation holding the remaining listeners, Done() if none is left. The event must outlive it
+        /// \example auto pending = onChunkLoaded.RaiseBudgeted(std::chrono::milliseconds(2), chunk); // next frames: pending.Resume(2ms);
+        [[maybe_unused]] [[nodiscard]] BudgetedRaise<Args...> RaiseBudgeted(const RaiseBudget &budget, EventParamT<Args>... args)
+        {
+            BudgetedRaise<Args...> raise(*this, args...);
+            raise.Entries.reserve(Binder.Persistent.LiveCount() + Binder.Once.LiveCount());
+            Binder.Walk([this, &raise](auto& lane, std::size_t i, auto)
+            {
+                const std::uint32_t slot = lane.Listeners[i].Slot;
+                raise.Entries.push_back({slot, Binder.Slots[slot].Generation});
+                return false;
+            });
+            ResumeBudgeted(raise, budget);
+            return raise;
+        }
+
+        /// Parallel listeners per chunk in RaiseParallel. Runs shorter than two chunks are not fanned out
+        /// \param grain listeners per chunk, greater than zero
+        [[maybe_unused]] void SetParallelGrain(std::size_t grain)
+        {
+            assert(grain != 0 && "Parallel grain must be greater than zero");
+            ParallelGrain = grain;
+        }
 
-                if (functionVector.empty())
+    protected:
+        /// Raise, stopping as soon as the condition holds after a listener call
+        /// \param stopped checked after every listener
+        /// \param args forwarded to every listener without copies (see EventParam)
+        template<typename Stop>
+        void RaiseUntil(const Stop &stopped, [[maybe_unused]] EventParamT<Args>... args)
+        {
+            // Finished listeners are only tombstoned here, the storage is untouched until enough of them pile up
+            Binder.Walk([&](auto& lane, std::size_t i, auto once)
+            {
+                auto& listener = lane.Listeners[i];
+                if constexpr (decltype(once)::value)
                 {
-                    it = Binder.Binds.erase(it);
+                    // Every once listener is tombstoned right before its call, so nested raises skip it.
+                    // The lane is then released in a single pass, and cleared in one go when the outermost Raise ends
+                    Binder.Fire(i);
+                    Binder.Dispatch(listener, args...);
                 }
-                else
+                else if (!Binder.Dispatch(listener, args...) && !listener.Dead)
                 {
-                    ++it;
+                    Binder.Kill(lane, i);
                 }
-            }
+                return stopped();
+            });
+        }
+
+        /// Listener-major raise: each listener is called for the whole batch before the next one runs,
+        /// so its code and data stay hot. Once listeners only receive the first payload.
+        /// Coroutines awaiting this event then receive every payload, in order, as one raise each
+        /// \param count payloads in the batch
+        /// \param call invoked as call(callback, payloadIndex)
+        /// \param batch invoked as batch(batchCallback) for batch-aware listeners, or null to call them per payload
+        template<typename Call, typename Batch = std::nullptr_t>
+        void RaiseEach(std::size_t count, const Call &call, [[maybe_unused]] const Batch &batch = nullptr)
+        {
+            if (count == 0) return;
+            Binder.Walk([&](auto& lane, std::size_t i, auto once)
+            {
+                auto& listener = lane.Listeners[i];
+                if constexpr (decltype(once)::value)
+                {
+                    Binder.Fire(i);
+                    Binder.DispatchBatch(listener, 1, call);
+                    return false;
+                }
+#ifdef __cpp_lib_span
+                if constexpr (!std::is_same_v<Batch, std::nullptr_t>)
+                {
+                    if (listener.Batch)
+                    {
+                        using BatchListener = typename EventBinder<Args...>::BatchListener;
+                        batch(listener.Function.template Target<BatchListener>()->Function);
+                        return false;
+                    }
+                }
+#endif
+                if (!Binder.DispatchBatch(listener, count, call) && !listener.Dead)
+                {
+                    Binder.Kill(lane, i);
+                }
+                return false;
+            });
+            auto notify = [this](auto &&... args) { Binder.NotifyWaiters(args...); };
+            for (std::size_t i = 0; i < count && Binder.HasWaiters(); ++i) call(notify, i);
+        }
+
+        /// Resume the coroutines awaiting this event with the arguments of one raise
+        void NotifyWaiters(EventParamT<Args>... args)
+        {
+            if (Binder.HasWaiters()) Binder.NotifyWaiters(args...);
+        }
+
+    public:
+#ifdef __cpp_lib_span
+        /// Raise this Event once per payload, listener-major: each listener runs over the whole batch before the next one.
+        /// Listeners are fetched once per batch instead of once per payload. Once listeners only receive the first payload
+        /// \param payloads one tuple of arguments per raise
+        /// \example event.RaiseBatch(std::span<const std::tuple<int, float>>(hits));
+        [[maybe_unused]] void RaiseBatch(std::span<const std::tuple<Args...>> payloads)
+        {
+            RaiseEach(payloads.size(), [&payloads](const auto& callback, std::size_t i)
+            {
+                std::apply([&callback](auto&&... args) { callback(args...); }, payloads[i]);
+            });
+        }
+
+        /// Raise this Event once per row of the columns, listener-major. Batch-aware listeners (BindBatch) receive the
+        /// columns directly in a single call. Every column must have the same size
+        /// \param columns one span per event argument
+        /// \example event.RaiseBatch(std::span<const int>(targets), std::span<const float>(damage));
+        [[maybe_unused]] void RaiseBatch(EventColumnT<Args>... columns) requires (sizeof...(Args) > 0)
+        {
+            const std::size_t sizes[] = {columns.size()...};
+            assert(std::all_of(std::begin(sizes), std::end(sizes), [&sizes](std::size_t size) { return size == sizes[0]; })
+                   && "Batch columns must have the same size");
+            RaiseEach(sizes[0],
+                      [&columns...](const auto& callback, std::size_t i) { callback(columns[i]...); },
+                      [&columns...](const auto& batchCallback) { batchCallback(columns...); });
         }
+#endif
 
         /// How many objects are attached to this event.
         /// \return Objects observing this event count
         [[maybe_unused]] [[nodiscard]] inline int Size()
         {
-            return Binder.Binds.size();
+            return static_cast<int>(Binder.OwnerSlots.size());
         }
 
         /// How many functions are attached to this event.
         /// \return This Event functions call count
         [[maybe_unused]] [[nodiscard]] inline int CallbackCount()
         {
-            int total = 0;
-            for (const auto& pair : Binder.Binds) total += pair.second.size();
-            return total;
+            return static_cast<int>(Binder.Persistent.LiveCount() + Binder.Once.LiveCount());
+        }
+
+        /// How many listeners the storage holds, including removed ones not compacted yet.
+        /// \return stored listener count, at least CallbackCount
+        [[maybe_unused]] [[nodiscard]] inline std::size_t StoredCount() const
+        {
+            return Binder.Persistent.StoredCount() + Binder.Once.StoredCount();
+        }
+
+        /// Drop removed, fired once and expired listeners from the storage now instead of waiting for the dead ratio threshold.
+        /// Handy after a burst of removals, before a hot sequence of Raise calls
+        [[maybe_unused]] inline void Compact()
+        {
+            Binder.Compact();
         }
 
-        /// Cleanup expired weak pointers. (It automatically cleans up on Raise)
+        /// Remove every listener whose weak pointer expired and release its storage.
+        /// Raise already skips and removes them, this is for events that are rarely raised
         [[maybe_unused]] inline void Cleanup()
         {
-            assert(false && "Not implemented");
+            Binder.Persistent.CleanupCursor = 0;
+            Binder.Once.CleanupCursor = 0;
+            Binder.SweepExpired(Binder.Persistent.StoredCount() + Binder.Once.StoredCount());
+            Binder.Compact();
+        }
+
+        /// Incremental Cleanup: check at most maxListenersToVisit listeners, resuming where the previous call stopped.
+        /// Spread it over idle frame time to sweep big events without a spike
+        /// \param maxListenersToVisit how many listeners to check in this call
+        /// \return true if the sweep reached the end of the listeners, the next call starts a new sweep
+        /// \example while (!event.Cleanup(256) && HasIdleTime()) {}
+        [[maybe_unused]] inline bool Cleanup(std::size_t maxListenersToVisit)
+        {
+            return Binder.SweepExpired(maxListenersToVisit);
         }
 
 #pragma region Binder Wrapper
         /** Convenient functions wrapper to Binder **/
-        using Callback = std::function<void(Args...)>;
-        [[maybe_unused]] inline void Bind(Callback f) { Binder.Bind(f); }
-        [[maybe_unused]] inline void BindOnce(Callback f) { Binder.BindOnce(f); }
+        using Callback = typename EventBinder<Args...>::Callback;
+        [[maybe_unused]] inline Connection Bind(Callback f, int priority = 0) { return Binder.Bind(std::move(f), priority); }
+        [[maybe_unused]] inline Connection BindOnce(Callback f, int priority = 0) { return Binder.BindOnce(std::move(f), priority); }
         template <typename T>
-        [[maybe_unused]] inline void Bind(Callback f, T* t) { Binder.Bind(f,t); }
+        [[maybe_unused]] inline Connection Bind(Callback f, T* t, int priority = 0) { return Binder.Bind(std::move(f),t, priority); }
         template <typename T>
-        [[maybe_unused]] inline void BindOnce(Callback f, T* t) { Binder.BindOnce(f,t); }
+        [[maybe_unused]] inline Connection BindOnce(Callback f, T* t, int priority = 0) { return Binder.BindOnce(std::move(f),t, priority); }
         template <typename T>
-        [[maybe_unused]] inline void Bind(void(T::* const f)(Args...), T* const t) { Binder.Bind(f,t); }
+        [[maybe_unused]] inline Connection Bind(void(T::* const f)(Args...), T* const t, int priority = 0) { return Binder.Bind(f,t, priority); }
         template <typename T>
-        [[maybe_unused]] inline void BindOnce(void(T::* const f)(Args...), T* const t) { Binder.BindOnce(f,t); }
+        [[maybe_unused]] inline Connection BindOnce(void(T::* const f)(Args...), T* const t, int priority = 0) { return Binder.BindOnce(f,t, priority); }
         template <typename T>
-        [[maybe_unused]] inline void Bind(void(T::* const f)(Args...), std::weak_ptr<T> t) { Binder.Bind(f, t); }
+        [[maybe_unused]] inline Connection Bind(void(T::* const f)(Args...), std::weak_ptr<T> t, int priority = 0) { return Binder.Bind(f, t, priority); }
         template <typename T>
-        [[maybe_unused]] inline void Bind(void(T::* const f)(Args...), std::shared_ptr<T> t) { Binder.Bind(f, t); }
+        [[maybe_unused]] inline Connection Bind(void(T::* const f)(Args...), std::shared_ptr<T> t, int priority = 0) { return Binder.Bind(f, t, priority); }
         template <typename T>
-        [[maybe_unused]] inline void BindOnce(void(T::* const f)(Args...), std::shared_ptr<T> t) { Binder.BindOnce(f, t); }
+        [[maybe_unused]] inline Connection BindOnce(void(T::* const f)(Args...), std::shared_ptr<T> t, int priority = 0) { return Binder.BindOnce(f, t, priority); }
         template <typename T>
-        [[maybe_unused]] inline void BindOnce(void(T::* const f)(Args...), std::weak_ptr<T> t) { Binder.BindOnce(f, t); }
+        [[maybe_unused]] inline Connection BindOnce(void(T::* const f)(Args...), std::weak_ptr<T> t, int priority = 0) { return Binder.BindOnce(f, t, priority); }
         template<typename T>
-        [[maybe_unused]] inline void Bind(Callback f, std::shared_ptr<T> t) { Binder.Bind(f, t); }
+        [[maybe_unused]] inline Connection Bind(Callback f, std::shared_ptr<T> t, int priority = 0) { return Binder.Bind(std::move(f), t, priority); }
         template<typename T>
-        [[maybe_unused]] inline void Bind(Callback f, std::weak_ptr<T> t) { Binder.Bind(f, t); }
+        [[maybe_unused]] inline Connection Bind(Callback f, std::weak_ptr<T> t, int priority = 0) { return Binder.Bind(std::move(f), t, priority); }
         template<typename T>
-        [[maybe_unused]] inline void BindOnce(Callback f, std::shared_ptr<T> t) { Binder.BindOnce(f, t); }
+        [[maybe_unused]] inline Connection BindOnce(Callback f, std::shared_ptr<T> t, int priority = 0) { return Binder.BindOnce(std::move(f), t, priority); }
         template<typename T>
-        [[maybe_unused]] inline void BindOnce(Callback f, std::weak_ptr<T> t) { Binder.BindOnce(f, t); }
+        [[maybe_unused]] inline Connection BindOnce(Callback f, std::weak_ptr<T> t, int priority = 0) { return Binder.BindOnce(std::move(f), t, priority); }
+        template <auto Method, typename T>
+        [[maybe_unused]] inline Connection Bind(T* const t, int priority = 0) { return Binder.template Bind<Method>(t, priority); }
+        template <auto Method, typename T>
+        [[maybe_unused]] inline Connection BindOnce(T* const t, int priority = 0) { return Binder.template BindOnce<Method>(t, priority); }
+        template <auto Method, typename T>
+        [[maybe_unused]] inline Connection Bind(std::weak_ptr<T> t, int priority = 0) { return Binder.template Bind<Method>(t, priority); }
+        template <auto Method, typename T>
+        [[maybe_unused]] inline Connection BindOnce(std::weak_ptr<T> t, int priority = 0) { return Binder.template BindOnce<Method>(t, priority); }
+        template <auto Method, typename T>
+        [[maybe_unused]] inline Connection Bind(std::shared_ptr<T> t, int priority = 0) { return Binder.template Bind<Method>(t, priority); }
+        template <auto Method, typename T>
+        [[maybe_unused]] inline Connection BindOnce(std::shared_ptr<T> t, int priority = 0) { return Binder.template BindOnce<Method>(t, priority); }
         template <typename T>
         [[maybe_unused]] inline bool Remove(T* const t) { return Binder.Remove(t); }
         template <typename T>
         [[maybe_unused]] inline bool Remove(std::shared_ptr<T> t) { return Binder.Remove(t); }
         template <typename T>
         [[maybe_unused]] inline bool Remove(std::weak_ptr<T> t) { return Binder.Remove(t); }
+#ifdef __cpp_lib_span
+        using BatchCallback = typename EventBinder<Args...>::BatchCallback;
+        [[maybe_unused]] inline Connection BindBatch(BatchCallback f, int priority = 0) { return Binder.BindBatch(std::move(f), priority); }
+        template <typename T>
+        [[maybe_unused]] inline Connection BindBatch(BatchCallback f, T* t, int priority = 0) { return Binder.BindBatch(std::move(f), t, priority); }
+#endif
+        [[maybe_unused]] inline Connection BindParallel(Callback f, int priority = 0) { return Binder.BindParallel(std::move(f), priority); }
+        template <typename T>
+        [[maybe_unused]] inline Connection BindParallel(Callback f, T* const t, int priority = 0) { return Binder.BindParallel(std::move(f), t, priority); }
+        template <typename T>
+        [[maybe_unused]] inline Connection BindParallel(void(T::* const f)(Args...), T* const t, int priority = 0) { return Binder.BindParallel(f, t, priority); }
+        template <auto Method, typename T>
+        [[maybe_unused]] inline Connection BindParallel(T* const t, int priority = 0) { return Binder.template BindParallel<Method>(t, priority); }
+        template <typename T>
+        [[maybe_unused]] inline Connection Bind(Callback f, T* const t, Executor& executor, int priority = 0) { return Binder.Bind(std::move(f), t, executor, priority); }
+        template <typename T>
+        [[maybe_unused]] inline Connection Bind(void(T::* const f)(Args...), T* const t, Executor& executor, int priority = 0) { return Binder.Bind(f, t, executor, priority); }
+#ifdef __cpp_lib_coroutine
+        [[nodiscard]] inline auto Next() { return Binder.Next(); }
+        [[nodiscard]] inline auto Stream(std::size_t capacity) { return Binder.Stream(capacity); }
+#endif
+        [[maybe_unused]] inline bool Remove(Connection& connection) { return Binder.Remove(connection); }
         [[maybe_unused]] inline void RemoveAll() { Binder.RemoveAll(); }
 #pragma endregion Binder Wrapper
 
     };
+
+    /// Continuation of Event::RaiseBudgeted: the arguments and the listeners left to call. Resume it once per frame until Done.
+    /// Dropping it, or calling Cancel, skips the remaining listeners. Move-only, it must not outlive its event
+    /// \tparam Args event arguments, stored by value
+    template<typename... Args>
+    class BudgetedRaise
+    {
+        friend Event<Args...>;
+
+    private:
+        /// Connection of a listener to call
+        struct Entry
+        {
+            std::uint32_t Slot;
+            std::uint32_t Generation;
+        };
+
+        Event<Args...> *Source;
+        std::tuple<std::decay_t<Args>...> Payload;
+        /// Listeners in dispatch order
+        std::vector<Entry> Entries{};
+        /// Next entry to visit
+        std::size_t Cursor = 0;
+
+        explicit BudgetedRaise(Event<Args...> &source, EventParamT<Args>... args) : Source(&source), Payload(args...) {}
+
+    public:
+        BudgetedRaise(BudgetedRaise &&other) noexcept
+            : Source(other.Source), Payload(std::move(other.Payload)), Entries(std::move(other.Entries)), Cursor(other.Cursor)
+        {
+            other.Entries.clear();
+            other.Cursor = 0;
+        }
+
+        BudgetedRaise &operator=(BudgetedRaise &&other) noexcept
+        {
+            if (this != &other)
+            {
+                Source = other.Source;
+                Payload = std::move(other.Payload);
+                Entries = std::move(other.Entries);
+                Cursor = other.Cursor;
+                other.Entries.clear();
+                other.Cursor = 0;
+            }
+            return *this;
+        }
+
+        BudgetedRaise(const BudgetedRaise &) = delete;
+        BudgetedRaise &operator=(const BudgetedRaise &) = delete;
+
+        /// Call the next listeners until the budget is spent
+        /// \param budget time and/or listener count of this slice
+        /// \return true once every listener was called, Done() from then on
+        [[maybe_unused]] bool Resume(const RaiseBudget &budget = RaiseBudget())
+        {
+            if (Done()) return true;
+            return Source->ResumeBudgeted(*this, budget);
+        }
+
+        /// Skip the remaining listeners. Coroutines awaiting the event are not resumed by this raise
+        [[maybe_unused]] void Cancel()
+        {
+            Entries.clear();
+            Cursor = 0;
+        }
+
+        [[maybe_unused]] [[nodiscard]] bool Done() const { return Cursor == Entries.size(); }
+
+        /// Listeners left to visit, including the ones removed since the raise started (they will be skipped)
+        [[maybe_unused]] [[nodiscard]] std::size_t Remaining() const { return Entries.size() - Cursor; }
+    };
+
+    /// Event whose dispatch stops at the first listener that handles it, e.g. input and UI clicks.
+    /// Listeners receive a trailing Propagation token and call Stop() to claim the event.
+    /// Combine it with priorities so the listeners that should claim it first run first
+    /// \example ConsumableEvent<Click> onClick; onClick.Bind([](Click c, Propagation &p) { p.Stop(); }, 10);
+    template<typename... Args>
+    class ConsumableEvent : public Event<Args..., Propagation &>
+    {
+    public:
+        explicit ConsumableEvent(const std::string& name = "") : Event<Args..., Propagation &>(name) {}
+
+        /// Raise/Trigger this Event until a listener handles it
+        /// \param args forwarded to every listener without copies (see EventParam)
+        /// \return true if a listener stopped the propagation
+        inline bool operator()(EventParamT<Args>... args)
+        {
+            return Raise(args...);
+        }
+
+        /// Raise/Trigger this Event until a listener handles it.
+        /// Coroutines awaiting this event are resumed either way, after the listeners: they receive the arguments
+        /// followed by whether a listener handled the event
+        /// \param args forwarded to every listener without copies (see EventParam)
+        /// \return true if a listener stopped the propagation
+        [[maybe_unused]] bool Raise(EventParamT<Args>... args)
+        {
+            Propagation propagation;
+            this->RaiseUntil([&propagation]() { return propagation.IsStopped(); }, args..., propagation);
+            this->NotifyWaiters(args..., propagation);
+            return propagation.IsStopped();
+        }
+    };
+
+    /// Deferred companion of an Event: Push records payloads in a contiguous buffer, Flush dispatches all of them.
+    /// Flush is listener-major, each listener runs over every queued payload before the next listener, instead of
+    /// one full listener walk per payload. Payloads whose arguments are all trivially copyable are packed into a raw
+    /// buffer, written and grown with memcpy; the others are stored as tuples.
+    /// The event must outlive its queue.
+    /// \example EventQueue<int> damageQueue(onDamage); damageQueue.Push(10); ... damageQueue.Flush();
+    template<typename... Args>
+    class EventQueue
+    {
+    public:
+        /// A queued payload: arguments are stored by value
+        using Payload = std::tuple<std::decay_t<Args>...>;
+
+    private:
+        /// Payloads stored as tuples, for arguments that need their copy and move constructors
+        class TupleBuffer
+        {
+        private:
+            std::vector<Payload> Payloads{};
+
+        public:
+            void Push(EventParamT<Args>... args) { Payloads.emplace_back(args...); }
+
+            /// Call the callback with the arguments of a payload
+            template<typename Callback>
+            void Call(const Callback &callback, std::size_t index)
+            {
+                std::apply([&callback](auto &... args) { callback(args...); }, Payloads[index]);
+            }
+
+            [[nodiscard]] std::size_t Size() const { return Payloads.size(); }
+            void Clear() { Payloads.clear(); }
+            void Reserve(std::size_t capacity) { Payloads.reserve(capacity); }
+        };
+
+        /// Payloads of trivially copyable arguments. Each payload is a fixed-size record holding every argument at a
+        /// compile-time offset: Push memcpys the arguments in, growing copies the records with a single memcpy
+        class PackedBuffer
+        {
+        private:
+            struct Layout
+            {
+                std::size_t Offsets[sizeof...(Args) + 1]{};
+                std::size_t Size = 0;
+            };
+
+            /// Offset of every argument, each one aligned, in argument order
+            static constexpr Layout Packing = []()
+            {
+                Layout layout{};
+                [[maybe_unused]] std::size_t i = 0;
+                ((layout.Size = (layout.Size + alignof(std::decay_t<Args>) - 1) / alignof(std::decay_t<Args>) * alignof(std::decay_t<Args>),
+                  layout.Offsets[i++] = layout.Size,
+                  layout.Size += sizeof(std::decay_t<Args>)), ...);
+                return layout;
+            }();
+            static constexpr std::size_t Alignment = std::max({alignof(unsigned char), alignof(std::decay_t<Args>)...});
+
+            /// One payload. Sized as a multiple of its alignment, so records are contiguous and every argument aligned
+            struct alignas(Alignment) Record
+            {
+                unsigned char Bytes[Packing.Size != 0 ? Packing.Size : 1];
+            };
+
+            std::unique_ptr<Record[]> Records{};
+            std::size_t Count = 0;
+            std::size_t Capacity = 0;
+
+            void Grow(std::size_t capacity)
+            {
+                // Records are left uninitialized, only the first Count ones are copied over
+                std::unique_ptr<Record[]> records(new Record[capacity]);
+                if (Count != 0) std::memcpy(static_cast<void *>(records.get()), Records.get(), Count * sizeof(Record));
+                Records = std::move(records);
+                Capacity = capacity;
+            }
+
+            template<std::size_t... I>
+            void Write(Record &record, std::index_sequence<I...>, EventParamT<Args>... args)
+            {
+                (std::memcpy(record.Bytes + Packing.Offsets[I], std::addressof(args), sizeof(std::decay_t<Args>)), ...);
+            }
+
+            template<typename Callback, std::size_t... I>
+            void Read(const Callback &callback, Record &record, std::index_sequence<I...>)
+            {
+                callback(*std::launder(reinterpret_cast<std::decay_t<Args> *>(record.Bytes + Packing.Offsets[I]))...);
+            }
+
+        public:
+            void Push(EventParamT<Args>... args)
+            {
+                if (Count == Capacity) Grow(Capacity != 0 ? Capacity * 2 : 16);
+                Write(Records[Count], std::index_sequence_for<Args...>{}, args...);
+                ++Count;
+            }
+
+            /// Call the callback with the arguments of a payload
+            template<typename Callback>
+            void Call(const Callback &callback, std::size_t index)
+            {
+                Read(callback, Records[index], std::index_sequence_for<Args...>{});
+            }
+
+            [[nodiscard]] std::size_t Size() const { return Count; }
+            void Clear() { Count = 0; }
+
+            void Reserve(std::size_t capacity)
+            {
+                if (capacity > Capacity) Grow(capacity);
+            }
+        };
+
+        using Buffer = std::conditional_t<(std::is_trivially_copyable_v<std::decay_t<Args>> && ...), PackedBuffer, TupleBuffer>;
+
+        Event<Args...> &Target;
+        Buffer Payloads{};
+        /// Payloads being flushed. Kept between flushes to reuse its capacity
+        Buffer Flushing{};
+        bool IsFlushing = false;
+
+    public:
+        explicit EventQueue(Event<Args...> &event) : Target(event) {}
+        EventQueue(const EventQueue &) = delete;
+        EventQueue &operator=(const EventQueue &) = delete;
+
+        /// Record a payload, it is dispatched on the next Flush
+        /// \param args copied into the queue
+        [[maybe_unused]] void Push(EventParamT<Args>... args)
+        {
+            Payloads.Push(args...);
+        }
+
+        /// Record a payload, it is dispatched on the next Flush
+        [[maybe_unused]] inline void operator()(EventParamT<Args>... args)
+        {
+            Push(args...);
+        }
+
+        /// Dispatch every queued payload, in push order for each listener.
+        /// Payloads pushed by listeners meanwhile wait for the next Flush. Flushing from a listener does nothing
+        /// \return dispatched payloads
+        [[maybe_unused]] std::size_t Flush()
+        {
+            if (IsFlushing || Payloads.Size() == 0) return 0;
+            IsFlushing = true;
+            std::swap(Payloads, Flushing);
+            struct Reset
+            {
+                EventQueue &Queue;
+                ~Reset()
+                {
+                    Queue.Flushing.Clear();
+                    Queue.IsFlushing = false;
+                }
+            } reset{*this};
+
+            const std::size_t count = Flushing.Size();
+            Target.RaiseEach(count, [this](const auto &callback, std::size_t i)
+            {
+                Flushing.Call(callback, i);
+            });
+            return count;
+        }
+
+        /// Drop every queued payload without dispatching it
+        [[maybe_unused]] void Clear() { Payloads.Clear(); }
+
+        /// Queued payloads waiting for the next Flush
+        [[maybe_unused]] [[nodiscard]] std::size_t Size() const { return Payloads.Size(); }
+
+        [[maybe_unused]] [[nodiscard]] bool Empty() const { return Payloads.Size() == 0; }
+
+        /// Reserve room for this many payloads, so pushing a burst doesn't allocate
+        [[maybe_unused]] void Reserve(std::size_t capacity)
+        {
+            Payloads.Reserve(capacity);
+            Flushing.Reserve(capacity);
+        }
+    };
+
+    /// Broadcast group: many objects of the same type observing an event through the same member function.
+    /// Stores the member function once and a dense array of object pointers, bound to the event as a single listener.
+    /// Raise is one loop of direct, inlinable calls instead of one type-erased call per object.
+    /// The group is Trackable, destroying it disconnects it. Objects must be removed before they are destroyed.
+    /// \tparam Method member function called on every object, e.g. &Enemy::OnWorldTimeChanged
+    /// \tparam PrefetchDistance prefetch the object this many positions ahead while broadcasting, 0 disables it
+    /// \example BroadcastGroup<&Enemy::OnWorldTimeChanged> enemies; enemies.BindTo(world.OnDayNightChanged()); enemies.Add(&goblin);
+    template<auto Method, std::size_t PrefetchDistance = 0, typename M = decltype(Method)>
+    class BroadcastGroup;
+
+    template<auto Method, std::size_t PrefetchDistance, typename C, typename R, typename... P>
+    class BroadcastGroup<Method, PrefetchDistance, R (C::*)(P...)> : public Trackable
+    {
+    private:
+        using T = C;
+        /// Dense object array. Removed while broadcasting objects are nulled and compacted afterward
+        std::vector<T *> Objects{};
+        /// Position of every object in Objects, keeps Add and Remove O(1)
+        std::unordered_map<T *, std::size_t> Positions{};
+        /// Added while broadcasting, appended afterward
+        std::vector<T *> Pending{};
+        std::size_t Holes = 0;
+        /// Broadcast calls currently on the stack. Objects is only compacted and appended to while it is zero
+        std::size_t BroadcastDepth = 0;
+
+        static void Prefetch([[maybe_unused]] const void *address)
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            __builtin_prefetch(address);
+#endif
+        }
+
+        /// Fill the holes left by removals, and append the objects added while broadcasting
+        void Settle()
+        {
+            if (Holes != 0)
+            {
+                std::size_t write = 0;
+                for (std::size_t read = 0; read < Objects.size(); ++read)
+                {
+                    if (Objects[read] == nullptr) continue;
+                    Objects[write] = Objects[read];
+                    Positions[Objects[write]] = write;
+                    ++write;
+                }
+                Objects.resize(write);
+                Holes = 0;
+            }
+            for (T *object : Pending)
+            {
+                Positions[object] = Objects.size();
+                Objects.push_back(object);
+            }
+            Pending.clear();
+        }
+
+    public:
+        BroadcastGroup() = default;
+        /// The group is bound by address, it can't be copied
+        BroadcastGroup(const BroadcastGroup &) = delete;
+        BroadcastGroup &operator=(const BroadcastGroup &) = delete;
+
+        /// Add an observer. Added while broadcasting, it is first called on the next Raise
+        /// \param object object pointer, must stay valid until removed
+        /// \return false if the object was already in the group
+        [[maybe_unused]] bool Add(T *const object)
+        {
+            assert(object != nullptr && "Cannot add a null pointer");
+            if (!Positions.emplace(object, Objects.size() + Pending.size()).second) return false;
+            if (BroadcastDepth != 0) Pending.push_back(object);
+            else Objects.push_back(object);
+            return true;
+        }
+
+        /// Remove an observer. Removed while broadcasting, it is not called anymore
+        /// \param object object pointer
+        /// \return true if the object was in the group
+        [[maybe_unused]] bool Remove(T *const object)
+        {
+            auto position = Positions.find(object);
+            if (position == Positions.end()) return false;
+            const std::size_t index = position->second;
+            Positions.erase(position);
+            if (index >= Objects.size())
+            {
+                Pending.erase(std::find(Pending.begin(), Pending.end(), object));
+            }
+            else if (BroadcastDepth != 0)
+            {
+                Objects[index] = nullptr;
+                ++Holes;
+            }
+            else
+            {
+                // Order inside a group doesn't matter: move the last one into the hole
+                T *const last = Objects.back();
+                Objects.pop_back();
+                if (index < Objects.size())
+                {
+                    Objects[index] = last;
+                    Positions[last] = index;
+                }
+            }
+            return true;
+        }
+
+        [[maybe_unused]] [[nodiscard]] bool Contains(T *const object) const { return Positions.find(object) != Positions.end(); }
+
+        /// Objects in this group
+        [[maybe_unused]] [[nodiscard]] std::size_t Size() const { return Positions.size(); }
+
+        [[maybe_unused]] void Reserve(std::size_t capacity)
+        {
+            Objects.reserve(capacity);
+            Positions.reserve(capacity);
+        }
+
+        /// Call the member function on every object of the group.
+        /// Objects may raise the event again, and Add or Remove objects: the array is settled once the outermost broadcast ends
+        /// \param args method arguments
+        void Broadcast(P... args)
+        {
+            ++BroadcastDepth;
+            struct Guard
+            {
+                BroadcastGroup &Group;
+                ~Guard()
+                {
+                    if (--Group.BroadcastDepth == 0) Group.Settle();
+                }
+            } guard{*this};
+
+            T *const *objects = Objects.data();
+            const std::size_t count = Objects.size();
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                if constexpr (PrefetchDistance != 0)
+                {
+                    if (i + PrefetchDistance < count) Prefetch(objects[i + PrefetchDistance]);
+                }
+                if (T *const object = objects[i]) (object->*Method)(args...);
+            }
+        }
+
+        /// Bind this group to an event as a single listener
+        /// \param binder event binder
+        /// \param priority higher priorities are called first, equal ones in bind order
+        /// \return connection handle of the group listener
+        template<typename... Args>
+        [[maybe_unused]] Connection BindTo(EventBinder<Args...> &binder, int priority = 0)
+        {
+            return binder.template Bind<&BroadcastGroup::Broadcast>(this, priority);
+        }
+    };
 }
 
 #endif //SPARKLE_EVENT_H
\ No newline at end of file
@@ -0,0 +1,144 @@
+#ifndef SPARKLE_EVENT_BUS_H
+#define SPARKLE_EVENT_BUS_H
+
+#include "Event.h"
+
+namespace Sparkle
+{
+    /// Dense index of a message type, shared by every EventBus. Indices start at 0 and grow by one per type used
+    /// with a bus, in first-use order. No typeid, hashing or lookup: each type reads its own static
+    /// \tparam T message type, without cv or reference qualifiers
+    template<typename T>
+    class MessageIndex
+    {
+        static_assert(std::is_same_v<T, std::decay_t<T>>, "Message types are plain value types");
+
+        static std::size_t Next()
+        {
+            static std::atomic<std::size_t> counter{0};
+            return counter.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        template<typename> friend class MessageIndex;
+
+    public:
+        [[maybe_unused]] [[nodiscard]] static std::size_t Value()
+        {
+            static const std::size_t index = MessageIndex<void>::Next();
+            return index;
+        }
+    };
+
+    /// Global messages identified by their payload type, so systems share them without holding each other's events.
+    /// Each message type gets its own Event, stored in a flat array at the type MessageIndex: Publish is an array
+    /// access and a Raise. Single-threaded like Event
+    /// \example struct PlayerDied { int Id; }; bus.Subscribe<PlayerDied>([](const PlayerDied &e) {...}); bus.Publish(PlayerDied{7});
+    class EventBus
+    {
+    private:
+        /// Owns the event of a message type
+        struct ChannelBase
+        {
+            virtual ~ChannelBase() = default;
+            virtual void RemoveAll() = 0;
+        };
+
+        template<typename T>
+        struct TypedChannel final : ChannelBase
+        {
+            Event<T> Messages;
+
+            void RemoveAll() override { Messages.RemoveAll(); }
+        };
+
+        /// Channels by MessageIndex, null for types never subscribed to or published on this bus
+        std::vector<std::unique_ptr<ChannelBase>> Channels{};
+
+        /// Event of the message type, or null if it has no channel yet
+        template<typename T>
+        [[nodiscard]] Event<T> *Find() const
+        {
+            const std::size_t index = MessageIndex<T>::Value();
+            if (index >= Channels.size() || !Channels[index]) return nullptr;
+            return &static_cast<TypedChannel<T> *>(Channels[index].get())->Messages;
+        }
+
+    public:
+        EventBus() = default;
+        EventBus(const EventBus &) = delete;
+        EventBus &operator=(const EventBus &) = delete;
+
+        /// Event carrying the message type, created on first use. Use it for the whole binding API (BindOnce, weak pointers, ...)
+        /// \tparam T message type
+        /// \return event reference, stable for the lifetime of the bus
+        template<typename T>
+        [[maybe_unused]] Event<T> &Channel()
+        {
+            const std::size_t index = MessageIndex<T>::Value();
+            if (index >= Channels.size()) Channels.resize(index + 1);
+            if (!Channels[index]) Channels[index] = std::make_unique<TypedChannel<T>>();
+            return static_cast<TypedChannel<T> *>(Channels[index].get())->Messages;
+        }
+
+        /// Call the callback with every published message of this type
+        /// \tparam T message type
+        /// \param f lambda, functor or function pointer taking the message
+        /// \param priority higher priorities are called first
+        /// \return connection handle, disconnect it to unsubscribe
+        /// \example bus.Subscribe<PlayerDied>([](const PlayerDied &e) { ShowDeathScreen(e.Id); });
+        template<typename T>
+        [[maybe_unused]] Connection Subscribe(typename Event<T>::Callback f, int priority = 0)
+        {
+            return Channel<T>().Bind(std::move(f), priority);
+        }
+
+        /// Call the callback with every published message of this type, removed with Unsubscribe(owner)
+        /// \tparam T message type
+        /// \param f lambda, functor or function pointer taking the message
+        /// \param owner object the subscription belongs to
+        /// \param priority higher priorities are called first
+        /// \return connection handle, disconnect it to unsubscribe
+        template<typename T, typename O>
+        [[maybe_unused]] Connection Subscribe(typename Event<T>::Callback f, O *owner, int priority = 0)
+        {
+            return Channel<T>().Bind(std::move(f), owner, priority);
+        }
+
+        /// Remove every subscription of the owner to this message type
+        /// \return true if any was removed
+        template<typename T, typename O>
+        [[maybe_unused]] bool Unsubscribe(O *owner)
+        {
+            Event<T> *messages = Find<T>();
+            return messages != nullptr && messages->Remove(owner);
+        }
+
+        /// Raise the message to its subscribers. Does nothing, and allocates nothing, if the type has none
+        /// \param message passed to every subscriber (see EventParam)
+        /// \example bus.Publish(PlayerDied{playerId});
+        template<typename T>
+        [[maybe_unused]] void Publish(const T &message)
+        {
+            if (Event<T> *messages = Find<T>()) messages->Raise(message);
+        }
+
+        /// Does the message type have subscribers on this bus?
+        template<typename T>
+        [[maybe_unused]] [[nodiscard]] bool HasSubscribers() const
+        {
+            Event<T> *messages = Find<T>();
+            return messages != nullptr && messages->CallbackCount() != 0;
+        }
+
+        /// Remove every subscription of every message type. Channels stay in place, Channel references remain valid
+        [[maybe_unused]] void Clear()
+        {
+            for (auto &channel : Channels)
+            {
+                if (channel) channel->RemoveAll();
+            }
+        }
+    };
+}
+
+#endif //SPARKLE_EVENT_BUS_H
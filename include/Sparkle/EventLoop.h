@@ -0,0 +1,266 @@
+#ifndef SPARKLE_EVENT_LOOP_H
+#define SPARKLE_EVENT_LOOP_H
+
+#include "ConcurrentEvent.h"
+
+#ifdef __linux__
+#include <chrono>
+#include <cerrno>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+namespace Sparkle
+{
+    /// Coalescing wakeup over an eventfd: however many threads signal before the consumer wakes up,
+    /// the eventfd sees a single write and the consumer a single read
+    class Wakeup
+    {
+    private:
+        int Descriptor;
+        /// Set by the first Signal since the last Consume, the following ones skip the write
+        std::atomic<bool> Signaled{false};
+
+    public:
+        Wakeup() : Descriptor(eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) {}
+        Wakeup(const Wakeup &) = delete;
+        Wakeup &operator=(const Wakeup &) = delete;
+
+        ~Wakeup()
+        {
+            if (Descriptor >= 0) close(Descriptor);
+        }
+
+        /// Readable while signaled, register it in a poll loop
+        [[maybe_unused]] [[nodiscard]] int Fd() const { return Descriptor; }
+
+        /// False if the eventfd couldn't be created, errno tells why
+        [[maybe_unused]] [[nodiscard]] bool Valid() const { return Descriptor >= 0; }
+
+        /// Make the eventfd readable. Callable from any thread, only the first call since the last Consume writes
+        void Signal()
+        {
+            if (Signaled.exchange(true, std::memory_order_acq_rel)) return;
+            const std::uint64_t one = 1;
+            while (write(Descriptor, &one, sizeof(one)) < 0 && errno == EINTR) {}
+        }
+
+        /// Clear the signal. Call it before handling the work the signal announced, so new work signals again
+        void Consume()
+        {
+            std::uint64_t count = 0;
+            while (read(Descriptor, &count, sizeof(count)) < 0 && errno == EINTR) {}
+            // Acquire pairs with the producers' exchange: work signaled before is visible once cleared
+            Signaled.exchange(false, std::memory_order_acq_rel);
+        }
+    };
+
+    /// ConcurrentEventQueue whose pending state is exposed as an eventfd, so a poll loop sleeps until payloads arrive.
+    /// A burst of posts costs a single eventfd write and read
+    /// \tparam Args event arguments, stored by value
+    /// \example PollableEventQueue<int> queue(onPacket); loop.Watch(queue); // any thread: queue.Post(size);
+    template<typename... Args>
+    class PollableEventQueue
+    {
+    private:
+        ConcurrentEventQueue<Args...> Queue;
+        Wakeup Pending{};
+
+    public:
+        /// \param event raised with every drained payload
+        /// \param capacity payloads the ring holds, rounded up to a power of two
+        /// \param policy what Post does when the ring is full
+        explicit PollableEventQueue(Event<Args...> &event, std::size_t capacity = 1024, OverflowPolicy policy = OverflowPolicy::Block)
+            : Queue(event, capacity, policy) {}
+
+        /// Readable while payloads are pending
+        [[maybe_unused]] [[nodiscard]] int Fd() const { return Pending.Fd(); }
+
+        /// Queue a payload from any thread and wake the loop if it isn't already
+        /// \return false if the payload was dropped (OverflowPolicy::Drop)
+        [[maybe_unused]] bool Post(EventParamT<Args>... args)
+        {
+            if (!Queue.Post(args...)) return false;
+            Pending.Signal();
+            return true;
+        }
+
+        /// Queue a payload from any thread
+        [[maybe_unused]] inline bool operator()(EventParamT<Args>... args)
+        {
+            return Post(args...);
+        }
+
+        /// Clear the eventfd and raise the event with the queued payloads. Owner thread only
+        /// \param maxPayloads stop after this many, the eventfd stays readable if payloads are left
+        /// \return dispatched payloads
+        [[maybe_unused]] std::size_t Drain(std::size_t maxPayloads = static_cast<std::size_t>(-1))
+        {
+            Pending.Consume();
+            const std::size_t count = Queue.Drain(maxPayloads);
+            if (!Queue.Empty()) Pending.Signal();
+            return count;
+        }
+    };
+
+    /// epoll loop raising events when file descriptors become ready. Watch fds, timers and pollable queues,
+    /// then call Run or RunOnce from the thread owning the events. Only Stop may be called from other threads
+    class EventLoop
+    {
+    private:
+        struct Watcher
+        {
+            Delegate<void(std::uint32_t)> OnReady;
+            int Descriptor;
+            /// Created by the loop (timers), closed on removal
+            bool Owned;
+            bool Removed = false;
+        };
+
+        int EpollFd;
+        Wakeup StopSignal{};
+        std::atomic<bool> Stopping{false};
+        std::unordered_map<int, std::unique_ptr<Watcher>> Watchers{};
+        /// Watchers removed while dispatching, events of the same batch may still point to them
+        std::vector<std::unique_ptr<Watcher>> Removed{};
+
+        bool Add(int fd, std::uint32_t events, Delegate<void(std::uint32_t)> onReady, bool owned)
+        {
+            if (fd < 0 || Watchers.count(fd) != 0) return false;
+            auto watcher = std::make_unique<Watcher>(Watcher{std::move(onReady), fd, owned});
+            epoll_event event{};
+            event.events = events;
+            event.data.ptr = watcher.get();
+            if (epoll_ctl(EpollFd, EPOLL_CTL_ADD, fd, &event) != 0) return false;
+            Watchers.emplace(fd, std::move(watcher));
+            return true;
+        }
+
+    public:
+        EventLoop() : EpollFd(epoll_create1(EPOLL_CLOEXEC))
+        {
+            if (EpollFd < 0) return;
+            epoll_event event{};
+            event.events = EPOLLIN;
+            event.data.ptr = nullptr;
+            epoll_ctl(EpollFd, EPOLL_CTL_ADD, StopSignal.Fd(), &event);
+        }
+
+        EventLoop(const EventLoop &) = delete;
+        EventLoop &operator=(const EventLoop &) = delete;
+
+        ~EventLoop()
+        {
+            for (auto &entry : Watchers)
+            {
+                if (entry.second->Owned) close(entry.first);
+            }
+            if (EpollFd >= 0) close(EpollFd);
+        }
+
+        /// False if epoll or its stop eventfd couldn't be created, errno tells why
+        [[maybe_unused]] [[nodiscard]] bool Valid() const { return EpollFd >= 0 && StopSignal.Valid(); }
+
+        /// Raise the event with the ready epoll flags whenever the fd is ready. The fd stays owned by the caller
+        /// \param fd file descriptor to watch, at most once per loop
+        /// \param event raised with the ready epoll flags
+        /// \param events epoll flags to wait for, level-triggered unless EPOLLET is set
+        /// \return false if the fd is already watched or epoll refused it (errno)
+        [[maybe_unused]] bool Watch(int fd, Event<std::uint32_t> &event, std::uint32_t events = EPOLLIN)
+        {
+            return Add(fd, events, [&event](std::uint32_t ready) { event(ready); }, false);
+        }
+
+        /// Drain the queue whenever payloads were posted to it
+        /// \return false if epoll refused its eventfd (errno)
+        template<typename... Args>
+        [[maybe_unused]] bool Watch(PollableEventQueue<Args...> &queue)
+        {
+            return Add(queue.Fd(), EPOLLIN, [&queue](std::uint32_t) { queue.Drain(); }, false);
+        }
+
+        /// Raise the event on a monotonic timer, with how many times the timer expired since the last raise
+        /// \param event raised with the expiration count, more than 1 when the loop fell behind
+        /// \param interval time until the first expiration, and between expirations
+        /// \param repeat false for a one-shot timer
+        /// \return timerfd handle, pass it to Remove. -1 on failure (errno)
+        [[maybe_unused]] int AddTimer(Event<std::uint64_t> &event, std::chrono::nanoseconds interval, bool repeat = true)
+        {
+            const int fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+            if (fd < 0) return -1;
+            itimerspec spec{};
+            spec.it_value.tv_sec = static_cast<time_t>(interval.count() / 1000000000);
+            spec.it_value.tv_nsec = static_cast<long>(interval.count() % 1000000000);
+            if (spec.it_value.tv_sec == 0 && spec.it_value.tv_nsec == 0) spec.it_value.tv_nsec = 1;
+            if (repeat) spec.it_interval = spec.it_value;
+            const bool added = timerfd_settime(fd, 0, &spec, nullptr) == 0 && Add(fd, EPOLLIN, [fd, &event](std::uint32_t)
+            {
+                std::uint64_t expirations = 0;
+                if (read(fd, &expirations, sizeof(expirations)) == sizeof(expirations)) event(expirations);
+            }, true);
+            if (added) return fd;
+            close(fd);
+            return -1;
+        }
+
+        /// Stop watching the fd, closing it if it is a timer. Safe from a raised listener
+        /// \return false if the fd isn't watched
+        [[maybe_unused]] bool Remove(int fd)
+        {
+            auto found = Watchers.find(fd);
+            if (found == Watchers.end()) return false;
+            epoll_ctl(EpollFd, EPOLL_CTL_DEL, fd, nullptr);
+            if (found->second->Owned) close(fd);
+            found->second->Removed = true;
+            Removed.push_back(std::move(found->second));
+            Watchers.erase(found);
+            return true;
+        }
+
+        /// Wait for ready fds once and raise their events
+        /// \param timeoutMs how long to wait, -1 waits until something is ready or Stop is called
+        /// \return watched fds dispatched
+        [[maybe_unused]] std::size_t RunOnce(int timeoutMs = -1)
+        {
+            constexpr int MaxEvents = 64;
+            epoll_event events[MaxEvents];
+            const int ready = epoll_wait(EpollFd, events, MaxEvents, timeoutMs);
+            std::size_t dispatched = 0;
+            for (int i = 0; i < ready; ++i)
+            {
+                auto *watcher = static_cast<Watcher *>(events[i].data.ptr);
+                if (watcher == nullptr)
+                {
+                    StopSignal.Consume();
+                    continue;
+                }
+                if (watcher->Removed) continue;
+                watcher->OnReady(events[i].events);
+                ++dispatched;
+            }
+            Removed.clear();
+            return dispatched;
+        }
+
+        /// Dispatch ready fds until Stop is called
+        [[maybe_unused]] void Run()
+        {
+            while (!Stopping.load(std::memory_order_acquire)) RunOnce();
+            Stopping.store(false, std::memory_order_relaxed);
+        }
+
+        /// Make Run return once the current dispatch ends. Callable from any thread
+        [[maybe_unused]] void Stop()
+        {
+            Stopping.store(true, std::memory_order_release);
+            StopSignal.Signal();
+        }
+
+        /// Watched fds, timers and queues included
+        [[maybe_unused]] [[nodiscard]] std::size_t Size() const { return Watchers.size(); }
+    };
+}
+#endif
+
+#endif //SPARKLE_EVENT_LOOP_H
\ No newline at end of file
@@ -0,0 +1,368 @@
+#ifndef SPARKLE_SCHEDULER_H
+#define SPARKLE_SCHEDULER_H
+
+#include "Event.h"
+#include <array>
+#include <chrono>
+
+namespace Sparkle
+{
+    /// Handle of a scheduled raise, used to cancel it. Stale once the timer fired (one-shot) or got cancelled
+    struct TimerHandle
+    {
+        std::uint32_t Index = 0xFFFFFFFFu;
+        std::uint32_t Generation = 0;
+
+        [[maybe_unused]] [[nodiscard]] bool Valid() const { return Index != 0xFFFFFFFFu; }
+    };
+
+    /// Delayed and periodic raises on a hierarchical timing wheel. Time only moves through Advance.
+    /// Each of the 11 levels has 64 slots covering 6 more bits of the tick: a timer sits in the level of the highest
+    /// bit where its expiry differs from the current tick, and cascades one level down when its slot comes up.
+    /// Insert and cancel are O(1); Advance jumps from one occupied slot to the next through per-level bitmaps,
+    /// so empty ticks cost nothing. Single-threaded
+    /// \example Scheduler scheduler; scheduler.RaiseAfter(onDawn, std::chrono::milliseconds(3500)); scheduler.Advance(frameTime);
+    class Scheduler
+    {
+    public:
+        /// Queued raise. Captures up to 64 bytes never allocate
+        using Action = Delegate<void(), 64>;
+        using Duration = std::chrono::nanoseconds;
+
+    private:
+        static constexpr std::uint32_t None = 0xFFFFFFFFu;
+        static constexpr unsigned SlotBits = 6;
+        static constexpr unsigned Slots = 1u << SlotBits;
+        static constexpr unsigned Levels = 11;
+        /// Level of timers detached for firing
+        static constexpr std::uint8_t Firing = 0xFF;
+        /// Longest delay in ticks. Longer ones are saturated, so expiries stay clear of wrapping the 64-bit tick counter
+        static constexpr std::uint64_t MaxTicks = std::uint64_t{1} << 62;
+
+        struct Timer
+        {
+            Action Function{};
+            std::uint64_t Expiry = 0;
+            /// Ticks between raises, 0 for one-shot timers
+            std::uint64_t Period = 0;
+            std::uint32_t Prev = None;
+            /// Next timer of the same bucket, or of the free list
+            std::uint32_t Next = None;
+            std::uint32_t Generation = 0;
+            std::uint8_t Level = 0;
+            std::uint8_t Slot = 0;
+            bool Pending = false;
+        };
+
+        std::vector<Timer> Timers{};
+        std::uint32_t FreeTimer = None;
+        std::array<std::array<std::uint32_t, Slots>, Levels> Heads{};
+        /// Occupied slots of each level
+        std::array<std::uint64_t, Levels> Occupied{};
+        /// Timers of the slot being fired
+        std::uint32_t FiringHead = None;
+        const Duration Resolution;
+        /// Current tick
+        std::uint64_t Now = 0;
+        /// Time advanced but not yet worth a whole tick
+        Duration Remainder{0};
+        std::size_t PendingCount = 0;
+        bool Advancing = false;
+
+        std::uint32_t &HeadOf(const Timer &timer)
+        {
+            return timer.Level == Firing ? FiringHead : Heads[timer.Level][timer.Slot];
+        }
+
+        void Unlink(std::uint32_t index)
+        {
+            Timer &timer = Timers[index];
+            if (timer.Prev != None) Timers[timer.Prev].Next = timer.Next;
+            else HeadOf(timer) = timer.Next;
+            if (timer.Next != None) Timers[timer.Next].Prev = timer.Prev;
+            if (timer.Level != Firing && Heads[timer.Level][timer.Slot] == None) Occupied[timer.Level] &= ~(std::uint64_t{1} << timer.Slot);
+            timer.Prev = None;
+            timer.Next = None;
+        }
+
+        /// Link the timer in the bucket matching its expiry relative to the current tick. Expiry must not be before Now,
+        /// timers expiring now (cascaded to their exact tick) land in the level 0 slot about to fire
+        void Place(std::uint32_t index)
+        {
+            Timer &timer = Timers[index];
+            std::uint64_t differing = (timer.Expiry ^ Now) >> SlotBits;
+            unsigned level = 0;
+            for (; differing != 0; differing >>= SlotBits) ++level;
+            const auto slot = static_cast<unsigned>(timer.Expiry >> (level * SlotBits)) & (Slots - 1);
+            timer.Level = static_cast<std::uint8_t>(level);
+            timer.Slot = static_cast<std::uint8_t>(slot);
+            timer.Prev = None;
+            timer.Next = Heads[level][slot];
+            if (timer.Next != None) Timers[timer.Next].Prev = index;
+            Heads[level][slot] = index;
+            Occupied[level] |= std::uint64_t{1} << slot;
+        }
+
+        /// Tick at which the level's slot comes up: the current window of the level with the slot digit and zero below
+        [[nodiscard]] std::uint64_t SlotTick(unsigned level, unsigned slot) const
+        {
+            const unsigned shift = (level + 1) * SlotBits;
+            const std::uint64_t window = shift >= 64 ? 0 : (Now >> shift) << shift;
+            return window | (std::uint64_t{slot} << (level * SlotBits));
+        }
+
+        /// First tick after Now at which an occupied slot comes up, or UINT64_MAX if no timer is pending
+        [[nodiscard]] std::uint64_t NextTick() const
+        {
+            std::uint64_t next = static_cast<std::uint64_t>(-1);
+            for (unsigned level = 0; level < Levels; ++level)
+            {
+                if (Occupied[level] == 0) continue;
+                const auto current = static_cast<unsigned>(Now >> (level * SlotBits)) & (Slots - 1);
+                // Pending slots always come after the current one
+                const std::uint64_t ahead = Occupied[level] & ~((std::uint64_t{2} << current) - 1);
+                if (ahead == 0) continue;
+                unsigned slot = 0;
+                while (!(ahead >> slot & 1u)) ++slot;
+                next = std::min(next, SlotTick(level, slot));
+            }
+            return next;
+        }
+
+        std::uint32_t Allocate()
+        {
+            std::uint32_t index = FreeTimer;
+            if (index != None)
+            {
+                FreeTimer = Timers[index].Next;
+            }
+            else
+            {
+                index = static_cast<std::uint32_t>(Timers.size());
+                Timers.emplace_back();
+            }
+            return index;
+        }
+
+        void Free(std::uint32_t index)
+        {
+            Timer &timer = Timers[index];
+            timer.Function = Action{};
+            timer.Pending = false;
+            ++timer.Generation;
+            timer.Next = FreeTimer;
+            FreeTimer = index;
+            --PendingCount;
+        }
+
+        /// Whole ticks covering the delay, rounded up and saturated to MaxTicks
+        [[nodiscard]] std::uint64_t ToTicks(Duration delay) const
+        {
+            if (delay <= Duration::zero()) return 1;
+            // Rounded up without adding to the count, which overflows for delays close to Duration::max()
+            const auto ticks = static_cast<std::uint64_t>(delay.count() / Resolution.count())
+                               + (delay.count() % Resolution.count() != 0 ? 1 : 0);
+            return std::min(ticks, MaxTicks);
+        }
+
+        /// Tick the given number of ticks after Now, saturated at the last tick instead of wrapping around
+        [[nodiscard]] std::uint64_t TickAfter(std::uint64_t ticks) const
+        {
+            const auto last = static_cast<std::uint64_t>(-1);
+            return ticks > last - Now ? last : Now + ticks;
+        }
+
+        TimerHandle Schedule(Action action, std::uint64_t delay, std::uint64_t period)
+        {
+            const std::uint32_t index = Allocate();
+            Timer &timer = Timers[index];
+            timer.Function = std::move(action);
+            timer.Expiry = TickAfter(delay);
+            timer.Period = period;
+            timer.Pending = true;
+            Place(index);
+            ++PendingCount;
+            return TimerHandle{index, timer.Generation};
+        }
+
+        /// Re-place every timer of the slot, they land in lower levels
+        void Cascade(unsigned level, unsigned slot)
+        {
+            std::uint32_t index = Heads[level][slot];
+            Heads[level][slot] = None;
+            Occupied[level] &= ~(std::uint64_t{1} << slot);
+            while (index != None)
+            {
+                const std::uint32_t next = Timers[index].Next;
+                Place(index);
+                index = next;
+            }
+        }
+
+        /// Fire every timer of the level 0 slot of the current tick
+        std::size_t Fire()
+        {
+            const auto slot = static_cast<unsigned>(Now) & (Slots - 1);
+            FiringHead = Heads[0][slot];
+            Heads[0][slot] = None;
+            Occupied[0] &= ~(std::uint64_t{1} << slot);
+            for (std::uint32_t index = FiringHead; index != None; index = Timers[index].Next) Timers[index].Level = Firing;
+
+            std::size_t fired = 0;
+            while (FiringHead != None)
+            {
+                const std::uint32_t index = FiringHead;
+                Unlink(index);
+                Timer &timer = Timers[index];
+                ++fired;
+                if (timer.Period == 0)
+                {
+                    Action action = std::move(timer.Function);
+                    Free(index);
+                    action();
+                    continue;
+                }
+                // Periodic: rescheduled before the call, so the action can cancel it. The action is moved out
+                // meanwhile, cancelling or scheduling from it can't destroy or move it
+                timer.Expiry = TickAfter(timer.Period);
+                Place(index);
+                const std::uint32_t generation = timer.Generation;
+                Action action = std::move(timer.Function);
+                action();
+                if (Timers[index].Generation == generation) Timers[index].Function = std::move(action);
+            }
+            return fired;
+        }
+
+    public:
+        /// \param resolution duration of a tick. Delays are rounded up to whole ticks
+        explicit Scheduler(Duration resolution = std::chrono::milliseconds(1)) : Resolution(resolution)
+        {
+            assert(resolution > Duration::zero() && "Scheduler resolution must be positive");
+            for (auto &level : Heads) level.fill(None);
+        }
+
+        Scheduler(const Scheduler &) = delete;
+        Scheduler &operator=(const Scheduler &) = delete;
+
+        /// Call the action once the delay elapsed
+        /// \param delay time from now, at least one tick and at most 2^62 ticks
+        /// \param action called from Advance
+        /// \return handle, use it to cancel
+        [[maybe_unused]] TimerHandle After(Duration delay, Action action)
+        {
+            return Schedule(std::move(action), ToTicks(delay), 0);
+        }
+
+        /// Call the action every period, the first time one period from now
+        /// \param period time between calls, at least one tick and at most 2^62 ticks
+        /// \param action called from Advance
+        /// \return handle, use it to cancel
+        [[maybe_unused]] TimerHandle Every(Duration period, Action action)
+        {
+            const std::uint64_t ticks = ToTicks(period);
+            return Schedule(std::move(action), ticks, ticks);
+        }
+
+        /// Raise the event once the delay elapsed. Arguments are copied now
+        /// \param event must outlive the timer
+        /// \param delay time from now, at least one tick
+        /// \param args copied into the timer
+        /// \return handle, use it to cancel
+        /// \example scheduler.RaiseAfter(onExplosion, std::chrono::milliseconds(3500), position);
+        template<typename... Args>
+        [[maybe_unused]] TimerHandle RaiseAfter(Event<Args...> &event, Duration delay, EventParamT<Args>... args)
+        {
+            return After(delay, [&event, payload = std::tuple<std::decay_t<Args>...>(args...)]()
+            {
+                std::apply([&event](const auto &... values) { event.Raise(values...); }, payload);
+            });
+        }
+
+        /// Raise the event every period, the first time one period from now. Arguments are copied now
+        /// \param event must outlive the timer
+        /// \param period time between raises, at least one tick
+        /// \param args copied into the timer, every raise receives them
+        /// \return handle, use it to cancel
+        /// \example scheduler.RaiseEvery(onDayNightChanged, std::chrono::seconds(60));
+        template<typename... Args>
+        [[maybe_unused]] TimerHandle RaiseEvery(Event<Args...> &event, Duration period, EventParamT<Args>... args)
+        {
+            return Every(period, [&event, payload = std::tuple<std::decay_t<Args>...>(args...)]()
+            {
+                std::apply([&event](const auto &... values) { event.Raise(values...); }, payload);
+            });
+        }
+
+        /// Cancel a pending timer. Safe from a timer action, including its own
+        /// \return true if the timer was pending
+        [[maybe_unused]] bool Cancel(TimerHandle handle)
+        {
+            if (!IsPending(handle)) return false;
+            Unlink(handle.Index);
+            Free(handle.Index);
+            return true;
+        }
+
+        [[maybe_unused]] [[nodiscard]] bool IsPending(TimerHandle handle) const
+        {
+            return handle.Index < Timers.size() && Timers[handle.Index].Generation == handle.Generation && Timers[handle.Index].Pending;
+        }
+
+        /// Move time forward and fire the timers expiring meanwhile, in expiry order. Timers due on the same tick fire
+        /// in no particular order. Only occupied slots are visited. Advancing from a timer action does nothing
+        /// \param elapsed time since the last Advance
+        /// \return timers fired
+        [[maybe_unused]] std::size_t Advance(Duration elapsed)
+        {
+            if (Advancing) return 0;
+            Advancing = true;
+            struct Reset
+            {
+                bool &Flag;
+                ~Reset() { Flag = false; }
+            } reset{Advancing};
+
+            Remainder += elapsed;
+            const auto ticks = static_cast<std::uint64_t>(Remainder.count() / Resolution.count());
+            Remainder -= Resolution * static_cast<Duration::rep>(ticks);
+            const std::uint64_t target = Now + ticks;
+
+            std::size_t fired = 0;
+            for (;;)
+            {
+                const std::uint64_t next = NextTick();
+                if (next > target) break;
+                Now = next;
+                for (unsigned level = Levels - 1; level > 0; --level)
+                {
+                    if ((Now & ((std::uint64_t{1} << (level * SlotBits)) - 1)) != 0) continue;
+                    const auto slot = static_cast<unsigned>(Now >> (level * SlotBits)) & (Slots - 1);
+                    if (Occupied[level] >> slot & 1u) Cascade(level, slot);
+                }
+                fired += Fire();
+            }
+            Now = target;
+            return fired;
+        }
+
+        /// Cancel every pending timer
+        [[maybe_unused]] void Clear()
+        {
+            for (std::uint32_t index = 0; index < Timers.size(); ++index)
+            {
+                if (!Timers[index].Pending) continue;
+                Unlink(index);
+                Free(index);
+            }
+        }
+
+        /// Pending timers
+        [[maybe_unused]] [[nodiscard]] std::size_t Size() const { return PendingCount; }
+
+        /// Time elapsed through Advance, in whole ticks
+        [[maybe_unused]] [[nodiscard]] Duration Elapsed() const { return Resolution * static_cast<Duration::rep>(Now); }
+    };
+}
+
+#endif //SPARKLE_SCHEDULER_H
\ No newline at end of file
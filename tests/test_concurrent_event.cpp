@@ -0,0 +1,466 @@
+#include <catch2/catch_all.hpp>
+#include <Sparkle/ConcurrentEvent.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+using namespace Sparkle;
+
+struct CounterObject {
+    std::atomic<int> counter{0};
+
+    void Add(int value) { counter += value; }
+};
+
+TEST_CASE("ConcurrentEvent binds, orders and removes like Event", "[concurrent]") {
+    ConcurrentEvent<int> onValue("OnValue");
+    CounterObject obj;
+    std::vector<int> order;
+
+    onValue.Bind([&](int) { order.push_back(0); });
+    onValue.Bind([&](int) { order.push_back(1); }, 5);
+    Connection connection = onValue.Bind([&](int) { order.push_back(2); });
+    onValue.Bind(&CounterObject::Add, &obj);
+    onValue.Bind<&CounterObject::Add>(&obj);
+
+    onValue(3);
+    REQUIRE(order == std::vector<int>{1, 0, 2});
+    REQUIRE(obj.counter == 6);
+    REQUIRE(onValue.CallbackCount() == 5);
+
+    REQUIRE(connection.IsConnected());
+    REQUIRE(onValue.Remove(connection));
+    REQUIRE_FALSE(connection.IsConnected());
+    REQUIRE(onValue.Remove(&obj));
+    REQUIRE_FALSE(onValue.Remove(&obj));
+
+    order.clear();
+    onValue(3);
+    REQUIRE(order == std::vector<int>{1, 0});
+    REQUIRE(obj.counter == 6);
+
+    onValue.RemoveAll();
+    REQUIRE(onValue.CallbackCount() == 0);
+}
+
+TEST_CASE("ConcurrentEvent raises from many threads while listeners change", "[concurrent]") {
+    ConcurrentEvent<int> onValue("OnValue");
+    std::atomic<long> total{0};
+    onValue.Bind([&](int v) { total += v; });
+
+    constexpr int Raisers = 4;
+    constexpr int RaisesPerThread = 5000;
+    std::atomic<bool> done{false};
+    std::atomic<long> churned{0};
+
+    std::thread writer([&]() {
+        while (!done.load()) {
+            Connection c = onValue.Bind([&](int) { churned++; });
+            onValue.Remove(c);
+        }
+    });
+
+    std::vector<std::thread> raisers;
+    for (int i = 0; i < Raisers; ++i) {
+        raisers.emplace_back([&]() {
+            for (int j = 0; j < RaisesPerThread; ++j) onValue.Raise(1);
+        });
+    }
+    for (auto &t : raisers) t.join();
+    done = true;
+    writer.join();
+
+    REQUIRE(total == Raisers * RaisesPerThread);
+    REQUIRE(onValue.CallbackCount() == 1);
+}
+
+TEST_CASE("ConcurrentEvent Synchronize waits for running raises", "[concurrent]") {
+    ConcurrentEvent<> onPing("OnPing");
+    std::atomic<bool> entered{false};
+    std::atomic<bool> release{false};
+    std::atomic<bool> finished{false};
+
+    Connection connection = onPing.Bind([&]() {
+        entered = true;
+        while (!release.load()) std::this_thread::yield();
+        finished = true;
+    });
+
+    std::thread raiser([&]() { onPing(); });
+    while (!entered.load()) std::this_thread::yield();
+
+    onPing.Remove(connection);
+    std::thread releaser([&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        release = true;
+    });
+    ConcurrentEvent<>::Synchronize();
+    REQUIRE(finished);
+
+    raiser.join();
+    releaser.join();
+}
+
+TEST_CASE("ConcurrentEventQueue delivers posts from many threads on the draining thread", "[concurrent][queue]") {
+    Event<int, int> onValue("OnValue");
+    ConcurrentEventQueue<int, int> queue(onValue, 64, OverflowPolicy::Block);
+
+    constexpr int Producers = 4;
+    constexpr int PostsPerThread = 5000;
+    const auto owner = std::this_thread::get_id();
+    std::vector<int> lastSeen(Producers, -1);
+    bool ordered = true;
+    bool onOwner = true;
+    int received = 0;
+    onValue.Bind([&](int producer, int sequence) {
+        ordered = ordered && sequence == lastSeen[producer] + 1;
+        onOwner = onOwner && std::this_thread::get_id() == owner;
+        lastSeen[producer] = sequence;
+        ++received;
+    });
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < Producers; ++p) {
+        producers.emplace_back([&queue, p]() {
+            for (int i = 0; i < PostsPerThread; ++i) queue.Post(p, i);
+        });
+    }
+    while (received < Producers * PostsPerThread) queue.Drain();
+    for (auto &t : producers) t.join();
+
+    REQUIRE(ordered);
+    REQUIRE(onOwner);
+    REQUIRE(queue.Empty());
+    REQUIRE(queue.Drain() == 0);
+}
+
+TEST_CASE("ConcurrentEventQueue overflow policies", "[concurrent][queue]") {
+    Event<int> onValue("OnValue");
+    std::vector<int> values;
+    onValue.Bind([&](int v) { values.push_back(v); });
+
+    SECTION("Drop discards payloads once the ring is full") {
+        ConcurrentEventQueue<int> queue(onValue, 4, OverflowPolicy::Drop);
+        int accepted = 0;
+        for (int i = 0; i < 10; ++i) accepted += queue.Post(i) ? 1 : 0;
+        REQUIRE(accepted == 4);
+        REQUIRE(queue.Drain() == 4);
+        REQUIRE(values == std::vector<int>{0, 1, 2, 3});
+    }
+
+    SECTION("Grow chains larger rings and keeps the order") {
+        ConcurrentEventQueue<int> queue(onValue, 4, OverflowPolicy::Grow);
+        for (int i = 0; i < 100; ++i) REQUIRE(queue.Post(i));
+        REQUIRE(queue.Drain(10) == 10);
+        REQUIRE(queue.Drain() == 90);
+        REQUIRE(values.size() == 100);
+        for (int i = 0; i < 100; ++i) REQUIRE(values[i] == i);
+    }
+
+    SECTION("Grow from many threads loses nothing") {
+        ConcurrentEventQueue<int> queue(onValue, 2, OverflowPolicy::Grow);
+        std::vector<std::thread> producers;
+        for (int p = 0; p < 4; ++p) {
+            producers.emplace_back([&queue]() {
+                for (int i = 0; i < 2000; ++i) queue(1);
+            });
+        }
+        std::size_t drained = 0;
+        while (drained < 8000) drained += queue.Drain();
+        for (auto &t : producers) t.join();
+        REQUIRE(values.size() == 8000);
+    }
+}
+
+TEST_CASE("Executor listeners run inline on their thread and are queued from others", "[concurrent][executor]") {
+    Event<std::string> onMessage("OnMessage");
+    Executor inbox;
+    std::vector<std::string> received;
+    CounterObject obj;
+    Event<int> onValue("OnValue");
+
+    onMessage.Bind([&](const std::string &message) { received.push_back(message); }, &received, inbox);
+    onValue.Bind(&CounterObject::Add, &obj, inbox);
+
+    onMessage("inline");
+    onValue(2);
+    REQUIRE(received == std::vector<std::string>{"inline"});
+    REQUIRE(obj.counter == 2);
+    REQUIRE(inbox.Empty());
+
+    // Hand the inbox to another thread: raises from here are now queued
+    std::thread([&inbox]() { inbox.BindToCurrentThread(); }).join();
+    REQUIRE_FALSE(inbox.IsCurrent());
+    {
+        std::string message = "queued";
+        onMessage(message);
+    }
+    onValue(3);
+    REQUIRE(received.size() == 1);
+    REQUIRE(obj.counter == 2);
+
+    inbox.BindToCurrentThread();
+    REQUIRE(inbox.RunPending() == 2);
+    REQUIRE(received == std::vector<std::string>{"inline", "queued"});
+    REQUIRE(obj.counter == 5);
+}
+
+TEST_CASE("Removing an executor listener cancels its queued calls", "[concurrent][executor]") {
+    Event<int> onValue("OnValue");
+    Executor inbox;
+    CounterObject obj;
+    onValue.Bind(&CounterObject::Add, &obj, inbox);
+
+    std::thread([&inbox]() { inbox.BindToCurrentThread(); }).join();
+    onValue(1);
+    onValue(1);
+    REQUIRE(onValue.Remove(&obj));
+
+    inbox.BindToCurrentThread();
+    REQUIRE(inbox.RunPending() == 2);
+    REQUIRE(obj.counter == 0);
+}
+
+struct LargePayload {
+    double values[8] = {};
+};
+
+TEST_CASE("Executor queues common payloads inline and boxes oversized ones", "[concurrent][executor]") {
+    STATIC_REQUIRE(ExecutorBinding<int>::PostsInline);
+    STATIC_REQUIRE(ExecutorBinding<int, float, const std::string &>::PostsInline);
+    STATIC_REQUIRE(ExecutorBinding<std::uint64_t, double, double, double>::PostsInline);
+    STATIC_REQUIRE_FALSE(ExecutorBinding<const LargePayload &>::PostsInline);
+
+    Event<const LargePayload &> onLarge("OnLarge");
+    Executor inbox;
+    double sum = 0;
+    onLarge.Bind([&sum](const LargePayload &payload) { for (double v : payload.values) sum += v; }, &sum, inbox);
+
+    std::thread([&inbox]() { inbox.BindToCurrentThread(); }).join();
+    LargePayload payload;
+    for (int i = 0; i < 8; ++i) payload.values[i] = i;
+    onLarge(payload);
+
+    inbox.BindToCurrentThread();
+    REQUIRE(inbox.RunPending() == 1);
+    REQUIRE(sum == 28);
+}
+
+TEST_CASE("Executor delivers raises from another thread on its own thread", "[concurrent][executor]") {
+    Event<int> onValue("OnValue");
+    Executor inbox;
+    std::atomic<bool> ready{false};
+    std::atomic<bool> stop{false};
+    std::thread::id workerId;
+    bool onWorker = true;
+    int total = 0;
+
+    onValue.Bind([&](int v) {
+        onWorker = onWorker && std::this_thread::get_id() == workerId;
+        total += v;
+    }, &total, inbox);
+
+    std::thread worker([&]() {
+        workerId = std::this_thread::get_id();
+        inbox.BindToCurrentThread();
+        ready = true;
+        while (!stop.load()) inbox.RunPending();
+        inbox.RunPending();
+    });
+    while (!ready.load()) std::this_thread::yield();
+
+    for (int i = 0; i < 1000; ++i) onValue(1);
+    stop = true;
+    worker.join();
+
+    REQUIRE(onWorker);
+    REQUIRE(total == 1000);
+}
+
+struct SerialPool {
+    int calls = 0;
+
+    template<typename F>
+    void ParallelFor(std::size_t count, F &&chunk) {
+        ++calls;
+        for (std::size_t i = 0; i < count; ++i) chunk(i);
+    }
+};
+
+TEST_CASE("ThreadPool runs every chunk once and joins", "[concurrent][parallel]") {
+    ThreadPool pool(3);
+    std::vector<std::atomic<int>> hits(1000);
+    pool.ParallelFor(hits.size(), [&](std::size_t i) { hits[i]++; });
+    for (auto &hit : hits) REQUIRE(hit == 1);
+
+    // Nested calls run serially instead of deadlocking
+    std::atomic<int> nested{0};
+    pool.ParallelFor(8, [&](std::size_t) { pool.ParallelFor(4, [&](std::size_t) { nested++; }); });
+    REQUIRE(nested == 32);
+
+    REQUIRE_THROWS_AS(pool.ParallelFor(16, [](std::size_t i) { if (i == 7) throw std::runtime_error("chunk"); }),
+                      std::runtime_error);
+}
+
+TEST_CASE("RaiseParallel fans parallel listeners out and keeps priority order", "[concurrent][parallel]") {
+    Event<int> onAlarm("OnAlarm");
+    onAlarm.SetParallelGrain(16);
+    ThreadPool pool(3);
+
+    std::vector<std::atomic<int>> high(200);
+    std::vector<std::atomic<int>> low(200);
+    for (auto &counter : high) onAlarm.BindParallel([&counter](int v) { counter += v; }, 10);
+    for (auto &counter : low) onAlarm.BindParallel([&counter](int v) { counter += v; }, -10);
+
+    bool highDoneBeforeSerial = false;
+    bool lowPendingAtSerial = false;
+    onAlarm.Bind([&](int) {
+        highDoneBeforeSerial = std::all_of(high.begin(), high.end(), [](const std::atomic<int> &c) { return c == 1; });
+        lowPendingAtSerial = std::all_of(low.begin(), low.end(), [](const std::atomic<int> &c) { return c == 0; });
+    });
+
+    onAlarm.RaiseParallel(pool, 1);
+    REQUIRE(highDoneBeforeSerial);
+    REQUIRE(lowPendingAtSerial);
+    for (auto &counter : low) REQUIRE(counter == 1);
+
+    // Plain raises call parallel listeners serially
+    onAlarm.Raise(1);
+    for (auto &counter : high) REQUIRE(counter == 2);
+}
+
+TEST_CASE("RaiseParallel keeps small runs serial and accepts any pool", "[concurrent][parallel]") {
+    Event<> onTick("OnTick");
+    onTick.SetParallelGrain(4);
+    SerialPool pool;
+    CounterObject obj;
+    int count = 0;
+
+    for (int i = 0; i < 7; ++i) onTick.BindParallel([&count]() { ++count; });
+    onTick.RaiseParallel(pool);
+    REQUIRE(count == 7);
+    REQUIRE(pool.calls == 0);
+
+    onTick.BindParallel([&obj]() { obj.Add(1); }, &obj);
+    onTick.RaiseParallel(pool);
+    REQUIRE(count == 14);
+    REQUIRE(obj.counter == 1);
+    REQUIRE(pool.calls == 1);
+
+    REQUIRE(onTick.Remove(&obj));
+    onTick.RaiseParallel(pool);
+    REQUIRE(obj.counter == 1);
+}
+
+// Started before any test touches the epoch domain, so it is destroyed after the domain would be at exit
+static AsyncWorker &EarlySharedWorker = AsyncWorker::Shared();
+
+TEST_CASE("The shared async worker can still be running when the program exits", "[concurrent][async]") {
+    // The worker thread gets an epoch record when it recycles the payload, and releases it after static destruction started
+    AsyncEvent<int> onValue("OnValue");
+    std::atomic<int> total{0};
+    onValue.BindAsync([&](int v) { total += v; });
+    onValue.Raise(3).Wait();
+    REQUIRE(total == 3);
+    REQUIRE(&EarlySharedWorker == &AsyncWorker::Shared());
+}
+
+TEST_CASE("AsyncWorker runs every task posted before it is destroyed", "[concurrent][async]") {
+    std::atomic<int> ran{0};
+    for (int round = 0; round < 500; ++round) {
+        AsyncWorker worker(4);
+        worker.Post([&ran]() { ran++; });
+        std::this_thread::yield();
+        // May land while the worker is between its drain and the stop check
+        worker.Post([&ran]() { ran++; });
+    }
+    REQUIRE(ran == 1000);
+}
+
+TEST_CASE("AsyncEvent runs async listeners on a worker with one shared payload", "[concurrent][async]") {
+    AsyncEvent<std::string> onSave("OnSave");
+    AsyncWorker worker;
+    const auto raiser = std::this_thread::get_id();
+    std::atomic<int> offThread{0};
+    std::atomic<const std::string *> first{nullptr};
+    std::atomic<const std::string *> second{nullptr};
+    std::string sync;
+
+    onSave.BindAsync([&](const std::string &save) {
+        first = &save;
+        offThread += std::this_thread::get_id() != raiser ? 1 : 0;
+    }, worker);
+    onSave.BindAsync([&](const std::string &save) {
+        second = &save;
+        offThread += std::this_thread::get_id() != raiser ? 1 : 0;
+    }, worker);
+    onSave.Bind([&](const std::string &save) { sync = save; });
+
+    AsyncToken token = onSave("slot-1");
+    REQUIRE(sync == "slot-1");
+    token.Wait();
+    REQUIRE(token.Done());
+    REQUIRE(offThread == 2);
+    REQUIRE(first.load() != nullptr);
+    REQUIRE(first.load() == second.load());
+    REQUIRE(onSave.AsyncCount() == 2);
+}
+
+TEST_CASE("AsyncEvent recycles payloads and cancels removed listeners", "[concurrent][async]") {
+    AsyncEvent<int> onValue("OnValue");
+    AsyncWorker worker;
+    CounterObject obj;
+    std::atomic<int> total{0};
+
+    Connection connection = onValue.BindAsync([&](int v) { total += v; }, worker);
+    onValue.BindAsync(&CounterObject::Add, &obj, worker);
+
+    std::vector<AsyncToken> tokens;
+    for (int i = 0; i < 1000; ++i) tokens.push_back(onValue(1));
+    onValue.WaitIdle();
+    for (auto &token : tokens) REQUIRE(token.Done());
+    REQUIRE(total == 1000);
+    REQUIRE(obj.counter == 1000);
+
+    REQUIRE(connection.IsConnected());
+    REQUIRE(onValue.Remove(connection));
+    REQUIRE_FALSE(connection.IsConnected());
+    REQUIRE(onValue.Remove(&obj));
+    REQUIRE(onValue.AsyncCount() == 0);
+    REQUIRE(onValue(1).Done());
+    onValue.WaitIdle();
+    REQUIRE(total == 1000);
+    REQUIRE(obj.counter == 1000);
+}
+
+TEST_CASE("AsyncEvent is not an Event and removes async listeners by shared_ptr", "[concurrent][async]") {
+    // Raising through Event& would skip the async listeners
+    STATIC_REQUIRE_FALSE(std::is_convertible_v<AsyncEvent<int> &, Event<int> &>);
+
+    AsyncEvent<int> onValue("OnValue");
+    AsyncWorker worker;
+    auto obj = std::make_shared<CounterObject>();
+    int sync = 0;
+    onValue.BindAsync(&CounterObject::Add, obj.get(), worker);
+    onValue.Bind([&sync](int v) { sync += v; }, obj);
+    REQUIRE(onValue.GetName() == "OnValue");
+    REQUIRE(onValue.Size() == 1);
+
+    onValue(2).Wait();
+    REQUIRE(obj->counter == 2);
+    REQUIRE(sync == 2);
+
+    REQUIRE(onValue.Remove(obj));
+    REQUIRE(onValue.AsyncCount() == 0);
+    REQUIRE(onValue.CallbackCount() == 0);
+    REQUIRE_FALSE(onValue.Remove(std::weak_ptr<CounterObject>(obj)));
+    onValue(2).Wait();
+    REQUIRE(obj->counter == 2);
+    REQUIRE(sync == 2);
+}
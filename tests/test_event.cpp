@@ -1,7 +1,9 @@
 #include <catch2/catch_all.hpp>
 #include <Sparkle/Event.h>
+#include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 using namespace Sparkle;
 
@@ -169,4 +171,1183 @@ TEST_CASE("IsBound detects bindings", "[event]") {
     REQUIRE_FALSE(onEvent.GetBinder().IsBound(&obj));
     onEvent.Bind(&TestObject::Increment, &obj);
     REQUIRE(onEvent.GetBinder().IsBound(&obj));
-}
\ No newline at end of file
+}
+
+TEST_CASE("Callbacks are raised in bind order", "[event]") {
+    Event<int> onOrder("OnOrder");
+    TestObject a, b;
+    std::string order;
+
+    onOrder.Bind([&](int) { order += "1"; }, &a);
+    onOrder.Bind([&](int) { order += "2"; });
+    onOrder.Bind([&](int) { order += "3"; }, &b);
+    onOrder.Bind([&](int) { order += "4"; }, &a);
+
+    onOrder(0);
+    REQUIRE(order == "1234");
+}
+
+TEST_CASE("Remove keeps other owners bound and ordered", "[event]") {
+    Event<int> onAdd("OnAdd");
+    TestObject a, b;
+    std::string order;
+
+    onAdd.Bind([&](int) { order += "a"; }, &a);
+    onAdd.Bind([&](int) { order += "b"; }, &b);
+    onAdd.Bind([&](int) { order += "A"; }, &a);
+    onAdd.Bind([&](int) { order += "B"; }, &b);
+    REQUIRE(onAdd.Size() == 2);
+
+    REQUIRE(onAdd.Remove(&a));
+    REQUIRE_FALSE(onAdd.Remove(&a));
+    REQUIRE_FALSE(onAdd.GetBinder().IsBound(&a));
+    REQUIRE(onAdd.GetBinder().IsBound(&b));
+    REQUIRE(onAdd.Size() == 1);
+    REQUIRE(onAdd.CallbackCount() == 2);
+
+    onAdd(0);
+    REQUIRE(order == "bB");
+}
+
+TEST_CASE("Remove by owner only touches that owner's listeners", "[event]") {
+    Event<int> onAdd("OnAdd");
+    TestObject a, b;
+    std::vector<Connection> aConnections, bConnections;
+
+    for (int i = 0; i < 8; ++i) {
+        aConnections.push_back(onAdd.Bind(&TestObject::Add, &a));
+        bConnections.push_back(onAdd.Bind(&TestObject::Add, &b));
+    }
+    aConnections.push_back(onAdd.BindOnce(&TestObject::Add, &a));
+    // Disconnect out of order so the owner index entries get swapped around
+    REQUIRE(aConnections[2].Disconnect());
+    REQUIRE(aConnections[7].Disconnect());
+    REQUIRE(bConnections[0].Disconnect());
+
+    REQUIRE(onAdd.Remove(&a));
+    REQUIRE_FALSE(onAdd.GetBinder().IsBound(&a));
+    for (auto &connection : aConnections) REQUIRE_FALSE(connection.IsConnected());
+    for (std::size_t i = 1; i < bConnections.size(); ++i) REQUIRE(bConnections[i].IsConnected());
+
+    onAdd(1);
+    REQUIRE(a.counter == 0);
+    REQUIRE(b.counter == 7);
+
+    // A once listener fired by the current Raise stays indexed until it ends
+    TestObject c;
+    onAdd.BindOnce(&TestObject::Add, &c, 2);
+    onAdd.Bind(&TestObject::Add, &c);
+    onAdd.Bind([&](int) { REQUIRE(onAdd.Remove(&c)); }, 1);
+    onAdd(1);
+    REQUIRE(c.counter == 1);
+    REQUIRE_FALSE(onAdd.GetBinder().IsBound(&c));
+    REQUIRE(onAdd.Size() == 2); // b and the standalone remover
+}
+
+static int FreeFunctionCalls = 0;
+static void FreeFunction(int value) { FreeFunctionCalls += value; }
+
+TEST_CASE("Delegate stores lambdas, free functions and member functions", "[delegate]") {
+    TestObject obj;
+    int captured = 0;
+
+    Delegate<void(int)> lambda([&](int v) { captured = v; });
+    Delegate<void(int)> function(&FreeFunction);
+    Delegate<void(int)> member(&obj, &TestObject::Add);
+
+    lambda(3);
+    function(4);
+    member(5);
+
+    REQUIRE(captured == 3);
+    REQUIRE(FreeFunctionCalls == 4);
+    REQUIRE(obj.counter == 5);
+}
+
+TEST_CASE("Delegate holds move-only and oversized callables", "[delegate]") {
+    auto value = std::make_unique<int>(7);
+    Delegate<int()> moveOnly([value = std::move(value)]() { return *value; });
+
+    struct Big { char padding[128]{}; int result = 9; };
+    Delegate<int()> big([b = Big{}]() { return b.result; });
+
+    Delegate<int()> moved = std::move(moveOnly);
+    REQUIRE_FALSE(moveOnly);
+    REQUIRE(moved() == 7);
+
+    big = std::move(moved);
+    REQUIRE(big() == 7);
+}
+
+TEST_CASE("Move-only lambda can be bound to an event", "[event]") {
+    Event<int> onValue("OnValue");
+    auto total = std::make_unique<int>(0);
+    int* observed = total.get();
+
+    onValue.Bind([total = std::move(total)](int v) { *total += v; });
+    onValue(2);
+    onValue(3);
+
+    REQUIRE(*observed == 5);
+}
+
+TEST_CASE("Compile-time member function binding", "[event]") {
+    Event<int> onAdd("OnAdd");
+    TestObject obj;
+
+    onAdd.Bind<&TestObject::Add>(&obj);
+    onAdd.BindOnce<&TestObject::Add>(&obj);
+    onAdd(2);
+    onAdd(3);
+
+    REQUIRE(obj.counter == 7);
+    REQUIRE(onAdd.CallbackCount() == 1);
+    REQUIRE(onAdd.Remove(&obj));
+}
+
+TEST_CASE("Compile-time member function binding with shared_ptr auto expires", "[event]") {
+    Event<int> onAdd("OnAdd");
+    {
+        auto strong = std::make_shared<TestObject>();
+        onAdd.Bind<&TestObject::Add>(strong);
+        onAdd(4);
+        REQUIRE(strong->counter == 4);
+    }
+    onAdd(1);
+    REQUIRE(onAdd.Size() == 0);
+}
+
+struct CopyCounter {
+    static inline int Copies = 0;
+    std::string payload = std::string(64, 'x');
+
+    CopyCounter() = default;
+    CopyCounter(const CopyCounter& other) : payload(other.payload) { Copies++; }
+    CopyCounter(CopyCounter&&) noexcept = default;
+};
+
+TEST_CASE("Raise never copies the payload per listener", "[event]") {
+    Event<CopyCounter> onPayload("OnPayload");
+    std::size_t seen = 0;
+
+    for (int i = 0; i < 8; ++i) {
+        onPayload.Bind([&](const CopyCounter& c) { seen += c.payload.size(); });
+    }
+
+    CopyCounter::Copies = 0;
+    CopyCounter value;
+    onPayload(value);
+    onPayload.Raise(value);
+
+    REQUIRE(CopyCounter::Copies == 0);
+    REQUIRE(seen == 2 * 8 * 64);
+}
+
+TEST_CASE("Move-only payload reaches every listener", "[event]") {
+    Event<std::unique_ptr<int>> onOwned("OnOwned");
+    int total = 0;
+
+    onOwned.Bind([&](const std::unique_ptr<int>& p) { total += *p; });
+    onOwned.Bind([&](const std::unique_ptr<int>& p) { total += *p; });
+
+    onOwned(std::make_unique<int>(21));
+    REQUIRE(total == 42);
+}
+
+TEST_CASE("Parameter policy passes small values by value and the rest by reference", "[event]") {
+    STATIC_REQUIRE(std::is_same_v<EventParamT<int>, int>);
+    STATIC_REQUIRE(std::is_same_v<EventParamT<std::string>, const std::string&>);
+    STATIC_REQUIRE(std::is_same_v<EventParamT<std::string&>, std::string&>);
+    STATIC_REQUIRE(std::is_same_v<EventParamT<const std::string&>, const std::string&>);
+}
+
+TEST_CASE("Connection removes a single standalone listener", "[connection]") {
+    Event<int> onValue("OnValue");
+    int a = 0, b = 0;
+
+    Connection first = onValue.Bind([&](int v) { a += v; });
+    Connection second = onValue.Bind([&](int v) { b += v; });
+    REQUIRE(first.IsConnected());
+
+    REQUIRE(onValue.Remove(first));
+    REQUIRE_FALSE(first.IsConnected());
+    REQUIRE_FALSE(first.Disconnect());
+    REQUIRE(onValue.CallbackCount() == 1);
+
+    onValue(5);
+    REQUIRE(a == 0);
+    REQUIRE(b == 5);
+    REQUIRE(second.IsConnected());
+}
+
+TEST_CASE("Stale connection does not remove a recycled slot", "[connection]") {
+    Event<> onPing("OnPing");
+    int count = 0;
+
+    Connection stale = onPing.Bind([&]() { count += 1; });
+    Connection copy = stale;
+    REQUIRE(stale.Disconnect());
+
+    Connection fresh = onPing.Bind([&]() { count += 10; });
+    REQUIRE_FALSE(copy.IsConnected());
+    REQUIRE_FALSE(copy.Disconnect());
+    REQUIRE(fresh.IsConnected());
+
+    onPing();
+    REQUIRE(count == 10);
+}
+
+TEST_CASE("Connection expires when its listener is removed by other means", "[connection]") {
+    Event<int> onAdd("OnAdd");
+    TestObject obj;
+
+    Connection once = onAdd.BindOnce([](int) {});
+    Connection owned = onAdd.Bind(&TestObject::Add, &obj);
+
+    onAdd(1);
+    REQUIRE_FALSE(once.IsConnected());
+    REQUIRE(owned.IsConnected());
+
+    onAdd.Remove(&obj);
+    REQUIRE_FALSE(owned.IsConnected());
+}
+
+TEST_CASE("ScopedConnection disconnects on destruction", "[connection]") {
+    Event<int> onValue("OnValue");
+    int result = 0;
+    {
+        ScopedConnection scoped = onValue.Bind([&](int v) { result += v; });
+        onValue(1);
+        REQUIRE(scoped.IsConnected());
+    }
+    onValue(1);
+    REQUIRE(result == 1);
+    REQUIRE(onValue.CallbackCount() == 0);
+
+    Connection kept;
+    {
+        ScopedConnection scoped = onValue.Bind([&](int v) { result += v; });
+        kept = scoped.Release();
+    }
+    onValue(1);
+    REQUIRE(result == 2);
+    REQUIRE(kept.Disconnect());
+}
+
+TEST_CASE("Dead listeners are compacted lazily and keep connections valid", "[event]") {
+    Event<int> onValue("OnValue");
+    std::string order;
+    std::vector<Connection> connections;
+
+    for (char c = 'a'; c <= 'h'; ++c) {
+        connections.push_back(onValue.Bind([&order, c](int) { order += c; }));
+    }
+
+    REQUIRE(connections[1].Disconnect());
+    REQUIRE(connections[4].Disconnect());
+    REQUIRE(onValue.CallbackCount() == 6);
+
+    onValue(0);
+    REQUIRE(order == "acdfgh");
+
+    onValue.Compact();
+    REQUIRE(onValue.CallbackCount() == 6);
+    REQUIRE(connections[7].IsConnected());
+    REQUIRE(connections[7].Disconnect());
+    REQUIRE(connections[0].Disconnect());
+
+    order.clear();
+    onValue(0);
+    REQUIRE(order == "cdfg");
+}
+
+TEST_CASE("Bind and Disconnect churn stays bounded without raising", "[event]") {
+    Event<int> onValue("OnValue");
+    TestObject kept;
+    onValue.Bind(&TestObject::Add, &kept);
+
+    for (int i = 0; i < 10000; ++i) {
+        Connection persistent = onValue.Bind([](int) {});
+        Connection once = onValue.BindOnce([](int) {}, i % 7);
+        REQUIRE(persistent.Disconnect());
+        REQUIRE(once.Disconnect());
+    }
+    REQUIRE(onValue.CallbackCount() == 1);
+    REQUIRE(onValue.StoredCount() <= 4);
+
+    onValue(1);
+    REQUIRE(kept.counter == 1);
+}
+
+TEST_CASE("Listeners can bind while the event is raised", "[reentrancy]") {
+    Event<int> onHit("OnHit");
+    int combo = 0;
+
+    onHit.BindOnce([&](int) {
+        // Enough binds to reallocate the storage being iterated
+        for (int i = 0; i < 64; ++i) {
+            onHit.Bind([&](int v) { combo += v; });
+        }
+    });
+
+    onHit(1);
+    REQUIRE(combo == 0); // bound during the raise, first called on the next one
+    REQUIRE(onHit.CallbackCount() == 64);
+
+    onHit(1);
+    REQUIRE(combo == 64);
+}
+
+TEST_CASE("Listeners can remove themselves and others while the event is raised", "[reentrancy]") {
+    Event<> onPing("OnPing");
+    TestObject later;
+    std::string order;
+    Connection self;
+
+    self = onPing.Bind([&]() { order += "a"; self.Disconnect(); });
+    onPing.Bind([&]() { order += "b"; onPing.Remove(&later); });
+    onPing.Bind([&]() { order += "c"; }, &later);
+    onPing.Bind([&]() { order += "d"; });
+
+    onPing();
+    REQUIRE(order == "abd");
+
+    onPing();
+    REQUIRE(order == "abdbd");
+    REQUIRE(onPing.CallbackCount() == 2);
+}
+
+TEST_CASE("Nested Raise calls each listener and BindOnce runs only once", "[reentrancy]") {
+    Event<int> onDepth("OnDepth");
+    int once = 0;
+    std::string order;
+
+    onDepth.BindOnce([&](int) { once++; });
+    onDepth.Bind([&](int depth) {
+        order += std::to_string(depth);
+        if (depth < 2) onDepth(depth + 1);
+    });
+
+    onDepth(0);
+    REQUIRE(once == 1);
+    REQUIRE(order == "012");
+    REQUIRE(onDepth.CallbackCount() == 1);
+}
+
+TEST_CASE("RemoveAll while raising stops the remaining listeners", "[reentrancy]") {
+    Event<> onClear("OnClear");
+    int called = 0;
+
+    onClear.Bind([&]() { called++; onClear.RemoveAll(); onClear.Bind([&]() { called += 10; }); });
+    onClear.Bind([&]() { called += 100; });
+
+    onClear();
+    REQUIRE(called == 1);
+    REQUIRE(onClear.CallbackCount() == 1);
+
+    onClear();
+    REQUIRE(called == 11);
+}
+
+TEST_CASE("Cleanup removes expired listeners without raising", "[cleanup]") {
+    Event<int> onLevelComplete("OnLevelComplete");
+    TestObject kept;
+    std::weak_ptr<TestObject> weak;
+    {
+        auto strong = std::make_shared<TestObject>();
+        weak = strong;
+        onLevelComplete.Bind(&TestObject::Add, strong);
+        onLevelComplete.Bind([](int) {}, strong);
+    }
+    onLevelComplete.Bind(&TestObject::Add, &kept);
+    REQUIRE(onLevelComplete.CallbackCount() == 3);
+
+    onLevelComplete.Cleanup();
+    REQUIRE(onLevelComplete.CallbackCount() == 1);
+    REQUIRE(onLevelComplete.Size() == 1);
+
+    onLevelComplete(2);
+    REQUIRE(kept.counter == 2);
+}
+
+TEST_CASE("Incremental Cleanup resumes where it stopped", "[cleanup]") {
+    Event<> onIdle("OnIdle");
+    std::vector<std::shared_ptr<TestObject>> objects;
+    for (int i = 0; i < 10; ++i) {
+        objects.push_back(std::make_shared<TestObject>());
+        onIdle.Bind(&TestObject::Increment, objects.back());
+    }
+    for (std::size_t i = 0; i < objects.size(); i += 2) {
+        objects[i].reset();
+    }
+
+    REQUIRE_FALSE(onIdle.Cleanup(4));
+    REQUIRE(onIdle.CallbackCount() == 8);
+    REQUIRE_FALSE(onIdle.Cleanup(4));
+    REQUIRE(onIdle.CallbackCount() == 6);
+    REQUIRE(onIdle.Cleanup(4));
+    REQUIRE(onIdle.CallbackCount() == 5);
+
+    onIdle();
+    for (std::size_t i = 1; i < objects.size(); i += 2) {
+        REQUIRE(objects[i]->counter == 1);
+    }
+}
+
+struct TrackedObject : Trackable {
+    int counter = 0;
+
+    void Add(int value) { counter += value; }
+};
+
+TEST_CASE("Trackable disconnects its listeners when destroyed", "[trackable]") {
+    Event<int> onAdd("OnAdd");
+    Event<int> onOther("OnOther");
+    int standalone = 0;
+    onAdd.Bind([&](int v) { standalone += v; });
+    {
+        TrackedObject tracked;
+        onAdd.Bind(&TrackedObject::Add, &tracked);
+        onAdd.Bind<&TrackedObject::Add>(&tracked);
+        onOther.Bind([&tracked](int v) { tracked.Add(v); }, &tracked);
+        REQUIRE(tracked.ConnectionCount() == 3);
+
+        onAdd(1);
+        REQUIRE(tracked.counter == 2);
+    }
+    REQUIRE(onAdd.CallbackCount() == 1);
+    REQUIRE(onAdd.Size() == 1);
+    REQUIRE(onOther.CallbackCount() == 0);
+
+    onAdd(1);
+    onOther(1);
+    REQUIRE(standalone == 2);
+}
+
+TEST_CASE("Trackable forgets listeners removed by the event", "[trackable]") {
+    TrackedObject tracked;
+    {
+        Event<int> onAdd("OnAdd");
+        onAdd.BindOnce(&TrackedObject::Add, &tracked);
+        Connection connection = onAdd.Bind(&TrackedObject::Add, &tracked);
+        onAdd.Bind<&TrackedObject::Add>(&tracked);
+        REQUIRE(tracked.ConnectionCount() == 3);
+
+        onAdd(1);
+        REQUIRE(tracked.ConnectionCount() == 2);
+        connection.Disconnect();
+        REQUIRE(tracked.ConnectionCount() == 1);
+    }
+    // The event died first
+    REQUIRE(tracked.ConnectionCount() == 0);
+    REQUIRE(tracked.counter == 3);
+}
+
+TEST_CASE("Trackable forgets connections removed in any order", "[trackable]") {
+    STATIC_REQUIRE_FALSE(std::is_move_constructible_v<Trackable>);
+    Event<int> onAdd("OnAdd");
+    Event<int> onOther("OnOther");
+    TrackedObject tracked;
+    std::vector<Connection> connections;
+    for (int i = 0; i < 8; ++i) {
+        connections.push_back(onAdd.Bind(&TrackedObject::Add, &tracked));
+        connections.push_back(onOther.Bind<&TrackedObject::Add>(&tracked));
+    }
+    REQUIRE(tracked.ConnectionCount() == 16);
+
+    // First, last and middle connections, so the remaining ones get moved around
+    for (std::size_t i : {0, 15, 7, 1, 14, 8}) {
+        REQUIRE(connections[i].Disconnect());
+    }
+    REQUIRE(tracked.ConnectionCount() == 10);
+    onAdd(1);
+    onOther(10);
+    REQUIRE(tracked.counter == 5 + 50);
+
+    REQUIRE(onAdd.Remove(&tracked));
+    REQUIRE(tracked.ConnectionCount() == 5);
+    tracked.DisconnectAll();
+    REQUIRE(tracked.ConnectionCount() == 0);
+    REQUIRE(onOther.CallbackCount() == 0);
+
+    // Connections still work after the object was emptied
+    onOther.Bind<&TrackedObject::Add>(&tracked);
+    onOther(1);
+    REQUIRE(tracked.counter == 56);
+    REQUIRE(tracked.ConnectionCount() == 1);
+}
+
+TEST_CASE("Once listeners run in bind order with persistent ones and the lane is cleared", "[once]") {
+    Event<int> onLoad("OnLoad");
+    std::string order;
+    int triggers = 0;
+
+    onLoad.BindOnce([&](int) { order += "1"; });
+    onLoad.Bind([&](int) { order += "p"; });
+    onLoad.BindOnce([&](int) { order += "2"; onLoad.BindOnce([&](int) { order += "3"; }); });
+    for (int i = 0; i < 1000; ++i) {
+        onLoad.BindOnce([&](int) { triggers++; });
+    }
+    Connection skipped = onLoad.BindOnce([&](int) { order += "x"; });
+    REQUIRE(skipped.Disconnect());
+    REQUIRE(onLoad.CallbackCount() == 1003);
+
+    onLoad(0);
+    REQUIRE(order == "1p2");
+    REQUIRE(triggers == 1000);
+    REQUIRE(onLoad.CallbackCount() == 2);
+
+    onLoad(0);
+    REQUIRE(order == "1p2p3");
+    REQUIRE(onLoad.CallbackCount() == 1);
+}
+
+TEST_CASE("Fired once listeners give back their owners and connections", "[once]") {
+    Event<int> onLoad("OnLoad");
+    TestObject a, b;
+    TrackedObject tracked;
+    onLoad.BindOnce(&TestObject::Add, &a);
+    onLoad.BindOnce(&TestObject::Add, &a);
+    Connection last = onLoad.BindOnce(&TestObject::Add, &b);
+    onLoad.BindOnce(&TrackedObject::Add, &tracked);
+    onLoad.Bind(&TestObject::Add, &b);
+    REQUIRE(onLoad.Size() == 3);
+    REQUIRE(tracked.ConnectionCount() == 1);
+
+    int nested = 0;
+    onLoad.BindOnce([&](int v) {
+        // Fired listeners are already disconnected, and a nested Raise doesn't call them again
+        REQUIRE_FALSE(last.IsConnected());
+        REQUIRE(tracked.ConnectionCount() == 0);
+        onLoad.BindOnce([&](int) { nested++; });
+        onLoad(v);
+    });
+
+    onLoad(1);
+    REQUIRE(a.counter == 2);
+    REQUIRE(b.counter == 3); // once, persistent, then persistent again from the nested Raise
+    REQUIRE(tracked.counter == 1);
+    REQUIRE(nested == 0);
+    REQUIRE_FALSE(onLoad.GetBinder().IsBound(&a));
+    REQUIRE(onLoad.GetBinder().IsBound(&b));
+    REQUIRE(onLoad.Size() == 2); // b and the standalone listener bound by the nested Raise
+    REQUIRE(onLoad.CallbackCount() == 2);
+
+    // Recycled slots don't revive stale connections
+    Connection fresh = onLoad.BindOnce(&TestObject::Add, &a);
+    REQUIRE_FALSE(last.Disconnect());
+    REQUIRE(fresh.IsConnected());
+    onLoad(1);
+    REQUIRE(nested == 1);
+    REQUIRE(a.counter == 3);
+    REQUIRE(onLoad.Size() == 1);
+    REQUIRE(onLoad.CallbackCount() == 1);
+}
+
+TEST_CASE("Listeners are called by priority then bind order", "[priority]") {
+    Event<int> onInput("OnInput");
+    TestObject gameplay;
+    std::string order;
+
+    onInput.Bind([&](int) { order += "g1"; }, &gameplay);
+    onInput.Bind([&](int) { order += "i1"; }, 10);
+    onInput.BindOnce([&](int) { order += "o"; }, 5);
+    onInput.Bind([&](int) { order += "g2"; });
+    onInput.Bind([&](int) { order += "i2"; }, 10);
+    Connection low = onInput.Bind([&](int) { order += "l"; }, -1);
+    onInput.Bind([&](int) { order += "u"; }, &gameplay, 5);
+
+    onInput(0);
+    REQUIRE(order == "i1i2oug1g2l");
+
+    REQUIRE(low.Disconnect());
+    REQUIRE(onInput.Remove(&gameplay));
+    order.clear();
+    onInput(0);
+    REQUIRE(order == "i1i2g2");
+}
+
+TEST_CASE("Once and persistent listeners of the same priority run in bind order", "[priority][once]") {
+    Event<> onTick("OnTick");
+    std::string order;
+
+    onTick.Bind([&]() { order += "a"; }, 3);
+    onTick.BindOnce([&]() { order += "1"; }, 3);
+    onTick.Bind([&]() { order += "b"; }, 3);
+    onTick.BindOnce([&]() { order += "2"; }, 3);
+    onTick.BindOnce([&]() { order += "3"; }, 3);
+    onTick.Bind([&]() { order += "c"; }, 3);
+    onTick.BindOnce([&]() { order += "h"; }, 4);
+
+    onTick();
+    REQUIRE(order == "ha1b23c");
+
+    // Binds made while raising keep their place on the next Raise
+    order.clear();
+    onTick.BindOnce([&]() {
+        order += "4";
+        onTick.BindOnce([&]() { order += "5"; }, 3);
+    }, 3);
+    onTick();
+    REQUIRE(order == "abc4");
+    order.clear();
+    onTick.Bind([&]() { order += "d"; }, 3);
+    onTick();
+    REQUIRE(order == "abc5d");
+}
+
+TEST_CASE("Priority binds made while raising are ordered on the next Raise", "[priority]") {
+    Event<> onTick("OnTick");
+    std::string order;
+    Connection late;
+
+    onTick.BindOnce([&]() {
+        late = onTick.Bind([&]() { order += "h"; }, 100);
+        onTick.Bind([&]() { order += "z"; }, -100);
+    });
+    onTick.Bind([&]() { order += "m"; });
+
+    onTick();
+    REQUIRE(order == "m");
+
+    order.clear();
+    onTick();
+    REQUIRE(order == "hmz");
+    REQUIRE(late.Disconnect());
+
+    order.clear();
+    onTick();
+    REQUIRE(order == "mz");
+}
+
+struct ClickHandler {
+    int clicks = 0;
+
+    void OnClick(int, Propagation& propagation) {
+        clicks++;
+        propagation.Stop();
+    }
+};
+
+TEST_CASE("Consumable event stops at the first listener that handles it", "[consumable]") {
+    ConsumableEvent<int> onClick("OnClick");
+    ClickHandler button;
+    int missed = 0;
+    int observed = 0;
+
+    onClick.Bind([&](int, Propagation&) { observed++; }, 20);
+    onClick.Bind(&ClickHandler::OnClick, &button, 10);
+    onClick.Bind([&](int, Propagation&) { missed++; });
+    onClick.BindOnce([&](int, Propagation&) { missed++; });
+
+    REQUIRE(onClick(1));
+    REQUIRE(onClick.Raise(2));
+    REQUIRE(observed == 2);
+    REQUIRE(button.clicks == 2);
+    REQUIRE(missed == 0);
+    REQUIRE(onClick.CallbackCount() == 4);
+
+    onClick.Remove(&button);
+    REQUIRE_FALSE(onClick(3));
+    REQUIRE(missed == 2);
+}
+
+TEST_CASE("Stopped raises keep unfired once listeners next to removed pending ones", "[consumable][once]") {
+    ConsumableEvent<int> onClick("OnClick");
+    int late = 0;
+
+    onClick.Bind([&](int, Propagation& propagation) {
+        Connection dropped = onClick.BindOnce([](int, Propagation&) {});
+        REQUIRE(dropped.Disconnect());
+        propagation.Stop();
+    }, 10);
+    Connection once = onClick.BindOnce([&](int, Propagation&) { late++; });
+
+    REQUIRE(onClick(1));
+    REQUIRE(once.IsConnected());
+    REQUIRE(onClick.CallbackCount() == 2);
+    REQUIRE(onClick.Size() == 1);
+
+    onClick.RemoveAll();
+    onClick.BindOnce([&](int, Propagation&) { late++; });
+    REQUIRE_FALSE(onClick(2));
+    REQUIRE(late == 1);
+    REQUIRE_FALSE(once.IsConnected());
+}
+
+TEST_CASE("EventQueue dispatches queued payloads listener by listener on Flush", "[queue]") {
+    Event<int, std::string> onDamage("OnDamage");
+    EventQueue<int, std::string> queue(onDamage);
+    std::string order;
+
+    onDamage.Bind([&](int amount, const std::string& source) { order += "a" + std::to_string(amount) + source; });
+    onDamage.BindOnce([&](int amount, const std::string&) { order += "o" + std::to_string(amount); });
+    onDamage.Bind([&](int amount, const std::string&) {
+        order += "b" + std::to_string(amount);
+        if (amount == 1) queue.Push(9, "later");
+    });
+
+    queue.Push(1, "x");
+    queue(2, "y");
+    REQUIRE(queue.Size() == 2);
+    REQUIRE(order.empty());
+
+    REQUIRE(queue.Flush() == 2);
+    REQUIRE(order == "a1xa2yo1b1b2");
+    REQUIRE(queue.Size() == 1);
+
+    order.clear();
+    REQUIRE(queue.Flush() == 1);
+    REQUIRE(order == "a9laterb9");
+    REQUIRE(queue.Flush() == 0);
+}
+
+TEST_CASE("EventQueue stops a listener removed mid-flush and skips expired owners", "[queue]") {
+    Event<int> onTick("OnTick");
+    EventQueue<int> queue(onTick);
+    int total = 0;
+    Connection self;
+
+    self = onTick.Bind([&](int v) { total += v; if (total >= 3) self.Disconnect(); });
+    {
+        auto strong = std::make_shared<TestObject>();
+        onTick.Bind(&TestObject::Add, strong);
+    }
+
+    for (int i = 0; i < 5; ++i) queue.Push(1);
+    queue.Flush();
+
+    REQUIRE(total == 3);
+    REQUIRE(onTick.CallbackCount() == 0);
+}
+
+struct alignas(32) Impact {
+    float x, y, z;
+};
+
+TEST_CASE("EventQueue packs trivially copyable payloads across growth and flushes", "[queue]") {
+    Event<char, Impact, double> onImpact("OnImpact");
+    EventQueue<char, Impact, double> queue(onImpact);
+    std::vector<float> seen;
+    double total = 0;
+    onImpact.Bind([&](char tag, const Impact& impact, double force) {
+        REQUIRE(reinterpret_cast<std::uintptr_t>(&impact) % alignof(Impact) == 0);
+        seen.push_back(impact.x + impact.y + impact.z);
+        total += force;
+        if (tag == 'r') queue.Push('n', Impact{1, 1, 1}, 0.5);
+    });
+
+    for (int i = 0; i < 100; ++i) queue.Push(i == 0 ? 'r' : 'x', Impact{float(i), 0, 0}, 1.0);
+    REQUIRE(queue.Flush() == 100);
+    REQUIRE(seen.size() == 100);
+    REQUIRE(seen[0] == 0.0f);
+    REQUIRE(seen[99] == 99.0f);
+    REQUIRE(total == 100.0);
+
+    // The payload pushed while flushing waits for the next Flush
+    seen.clear();
+    REQUIRE(queue.Size() == 1);
+    REQUIRE(queue.Flush() == 1);
+    REQUIRE(seen == std::vector<float>{3.0f});
+
+    queue.Push('x', Impact{}, 1.0);
+    queue.Clear();
+    REQUIRE(queue.Empty());
+    REQUIRE(queue.Flush() == 0);
+}
+
+TEST_CASE("RaiseBatch calls each listener over the whole batch", "[batch]") {
+    Event<int, std::string> onHit("OnHit");
+    std::string order;
+
+    onHit.Bind([&](int target, const std::string& weapon) { order += "a" + std::to_string(target) + weapon; });
+    onHit.BindOnce([&](int target, const std::string&) { order += "o" + std::to_string(target); });
+    onHit.Bind([&](int target, const std::string&) { order += "b" + std::to_string(target); });
+
+    std::vector<std::tuple<int, std::string>> hits{{1, "x"}, {2, "y"}};
+    onHit.RaiseBatch(hits);
+    REQUIRE(order == "a1xa2yo1b1b2");
+
+    order.clear();
+    std::vector<int> targets{3, 4};
+    std::vector<std::string> weapons{"z", "w"};
+    onHit.RaiseBatch(targets, weapons);
+    REQUIRE(order == "a3za4wb3b4");
+}
+
+TEST_CASE("Batch-aware listeners receive the columns directly", "[batch]") {
+    Event<int, float> onDamage("OnDamage");
+    float total = 0.0f;
+    int batches = 0;
+    int single = 0;
+
+    onDamage.BindBatch([&](std::span<const int> targets, std::span<const float> damage) {
+        batches++;
+        REQUIRE(targets.size() == damage.size());
+        for (float d : damage) total += d;
+    });
+    onDamage.Bind([&](int, float) { single++; });
+
+    std::vector<int> targets{1, 2, 3};
+    std::vector<float> damage{1.0f, 2.0f, 3.0f};
+    onDamage.RaiseBatch(targets, damage);
+    REQUIRE(batches == 1);
+    REQUIRE(total == 6.0f);
+    REQUIRE(single == 3);
+
+    onDamage(4, 4.0f);
+    REQUIRE(batches == 2);
+    REQUIRE(total == 10.0f);
+}
+
+TEST_CASE("BroadcastGroup calls every object through a single listener", "[group]") {
+    Event<int> onTime("OnTime");
+    std::vector<TestObject> objects(100);
+    {
+        BroadcastGroup<&TestObject::Add, 4> group;
+        group.Reserve(objects.size());
+        group.BindTo(onTime.GetBinder());
+        for (auto& object : objects) REQUIRE(group.Add(&object));
+        REQUIRE_FALSE(group.Add(&objects[0]));
+        REQUIRE(onTime.CallbackCount() == 1);
+
+        onTime(2);
+        REQUIRE(group.Remove(&objects[0]));
+        REQUIRE(group.Remove(&objects[99]));
+        REQUIRE_FALSE(group.Remove(&objects[0]));
+        REQUIRE(group.Size() == 98);
+        onTime(1);
+
+        REQUIRE(objects[0].counter == 2);
+        REQUIRE(objects[1].counter == 3);
+        REQUIRE(objects[99].counter == 2);
+    }
+    // Destroying the group disconnected it
+    REQUIRE(onTime.CallbackCount() == 0);
+}
+
+struct SelfRemoving {
+    std::function<void(SelfRemoving*)> OnTick;
+    int ticks = 0;
+
+    void Tick(int) {
+        ticks++;
+        OnTick(this);
+    }
+};
+
+TEST_CASE("BroadcastGroup supports Add and Remove while broadcasting", "[group]") {
+    Event<int> onTick("OnTick");
+    BroadcastGroup<&SelfRemoving::Tick> group;
+    group.BindTo(onTick.GetBinder());
+
+    SelfRemoving a, b, spawned;
+    a.OnTick = [&](SelfRemoving* self) { group.Remove(self); group.Add(&spawned); };
+    b.OnTick = spawned.OnTick = [&](SelfRemoving* self) { group.Remove(self); };
+    group.Add(&a);
+    group.Add(&b);
+
+    onTick(0);
+    REQUIRE(a.ticks == 1);
+    REQUIRE(b.ticks == 1);
+    REQUIRE(spawned.ticks == 0);
+    REQUIRE(group.Size() == 1);
+
+    onTick(0);
+    REQUIRE(a.ticks == 1);
+    REQUIRE(spawned.ticks == 1);
+    REQUIRE(group.Size() == 0);
+}
+
+TEST_CASE("BroadcastGroup supports nested broadcasts that add and remove objects", "[group][reentrancy]") {
+    Event<int> onTick("OnTick");
+    BroadcastGroup<&SelfRemoving::Tick> group;
+    group.BindTo(onTick.GetBinder());
+
+    std::vector<SelfRemoving> spawned(64);
+    std::size_t next = 0;
+    SelfRemoving trigger, victim, bystander;
+    trigger.OnTick = [&](SelfRemoving* self) {
+        if (trigger.ticks == 1) {
+            // Nested raise while this broadcast still walks the array
+            onTick(0);
+            group.Remove(&victim);
+            group.Remove(self);
+            group.Remove(&spawned[0]); // added by the nested broadcast, still pending
+        }
+        for (int i = 0; i < 16; ++i) group.Add(&spawned[next++]);
+    };
+    victim.OnTick = [&](SelfRemoving*) { group.Add(&spawned[next++]); };
+    bystander.OnTick = [](SelfRemoving*) {};
+    for (auto& object : spawned) object.OnTick = [](SelfRemoving*) {};
+    group.Add(&trigger);
+    group.Add(&victim);
+    group.Add(&bystander);
+
+    onTick(0);
+    // The nested raise ran every object once, the outer one skipped the victim removed meanwhile
+    REQUIRE(trigger.ticks == 2);
+    REQUIRE(victim.ticks == 1);
+    REQUIRE(bystander.ticks == 2);
+    REQUIRE(next == 33);
+    REQUIRE(group.Size() == 33);
+    for (std::size_t i = 0; i < next; ++i) REQUIRE(spawned[i].ticks == 0);
+
+    onTick(0);
+    REQUIRE(bystander.ticks == 3);
+    REQUIRE(spawned[0].ticks == 0);
+    for (std::size_t i = 1; i < next; ++i) REQUIRE(spawned[i].ticks == 1);
+    REQUIRE(group.Remove(&bystander));
+    REQUIRE(group.Size() == 32);
+}
+
+TEST_CASE("RaiseBudgeted spreads listeners across slices in Raise order", "[budget]") {
+    Event<std::string> onChunkLoaded("OnChunkLoaded");
+    std::vector<std::string> calls;
+    for (int i = 0; i < 5; ++i) onChunkLoaded.Bind([&calls, i](const std::string &chunk) { calls.push_back(chunk + std::to_string(i)); });
+    onChunkLoaded.Bind([&calls](const std::string &chunk) { calls.push_back(chunk + "first"); }, 10);
+    onChunkLoaded.BindOnce([&calls](const std::string &chunk) { calls.push_back(chunk + "once"); });
+
+    std::string chunk = "a";
+    auto pending = onChunkLoaded.RaiseBudgeted(RaiseBudget(3), chunk);
+    chunk = "changed"; // arguments were captured
+    REQUIRE(calls == std::vector<std::string>{"afirst", "a0", "a1"});
+    REQUIRE_FALSE(pending.Done());
+    REQUIRE(pending.Remaining() == 4);
+
+    REQUIRE_FALSE(pending.Resume(RaiseBudget(2)));
+    REQUIRE_FALSE(pending.Resume(RaiseBudget(0))); // a slice always calls at least one listener
+    REQUIRE(calls.back() == "a4");
+    REQUIRE(pending.Resume());
+    REQUIRE(pending.Done());
+    REQUIRE(calls.back() == "aonce");
+    REQUIRE(calls.size() == 7);
+    REQUIRE(onChunkLoaded.CallbackCount() == 6);
+
+    // A time budget always lets the first listener run
+    calls.clear();
+    auto timed = onChunkLoaded.RaiseBudgeted(std::chrono::nanoseconds(0), "b");
+    REQUIRE(calls.size() == 1);
+    while (!timed.Resume(std::chrono::milliseconds(100))) {}
+    REQUIRE(calls.size() == 6);
+}
+
+TEST_CASE("RaiseBudgeted skips listeners removed or bound between slices", "[budget]") {
+    Event<int> onValue("OnValue");
+    std::vector<int> calls;
+    onValue.Bind([&calls](int v) { calls.push_back(v); });
+    Connection removed = onValue.Bind([&calls](int) { calls.push_back(-1); });
+    onValue.BindOnce([&calls](int v) { calls.push_back(v * 10); });
+    onValue.Bind([&calls](int v) { calls.push_back(v * 100); });
+
+    auto pending = onValue.RaiseBudgeted(RaiseBudget(1), 1);
+    REQUIRE(calls == std::vector<int>{1});
+
+    removed.Disconnect();
+    onValue.Bind([&calls](int) { calls.push_back(-2); }, 100);
+    // A regular raise in between fires the once listener, the budgeted raise won't fire it again
+    onValue(2);
+    REQUIRE(calls == std::vector<int>{1, -2, 2, 20, 200});
+
+    REQUIRE(pending.Resume());
+    REQUIRE(calls == std::vector<int>{1, -2, 2, 20, 200, 100});
+
+    // Cancelled raises call nothing more
+    calls.clear();
+    auto cancelled = onValue.RaiseBudgeted(RaiseBudget(1), 3);
+    cancelled.Cancel();
+    REQUIRE(cancelled.Done());
+    REQUIRE(cancelled.Resume());
+    REQUIRE(calls == std::vector<int>{-2});
+}
+
+TEST_CASE("RaiseBudgeted slices keep unfired once listeners next to removed pending ones", "[budget][once]") {
+    Event<int> onValue("OnValue");
+    std::vector<int> calls;
+
+    onValue.Bind([&](int v) {
+        Connection dropped = onValue.BindOnce([&calls](int) { calls.push_back(-1); });
+        REQUIRE(dropped.Disconnect());
+        calls.push_back(v);
+    });
+    Connection once = onValue.BindOnce([&calls](int v) { calls.push_back(v * 10); });
+
+    auto pending = onValue.RaiseBudgeted(RaiseBudget(1), 1);
+    REQUIRE(calls == std::vector<int>{1});
+    REQUIRE(once.IsConnected());
+    REQUIRE(onValue.CallbackCount() == 2);
+
+    REQUIRE(pending.Resume());
+    REQUIRE(calls == std::vector<int>{1, 10});
+    REQUIRE_FALSE(once.IsConnected());
+    REQUIRE(onValue.CallbackCount() == 1);
+    REQUIRE(onValue.Size() == 1);
+}
+
+#ifdef __cpp_lib_coroutine
+struct FireAndForget {
+    struct promise_type {
+        FireAndForget get_return_object() { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+};
+
+TEST_CASE("Coroutines co_await the next raise", "[coroutine]") {
+    Event<int, std::string> onDialog("OnDialog");
+    Event<> onSkip("OnSkip");
+    std::vector<std::string> script;
+
+    auto tutorial = [&]() -> FireAndForget {
+        auto [line, text] = co_await onDialog.Next();
+        script.push_back(std::to_string(line) + ":" + text);
+        co_await onSkip.Next();
+        script.push_back("skipped");
+        auto [nextLine, nextText] = co_await onDialog.Next();
+        script.push_back(std::to_string(nextLine) + ":" + nextText);
+    };
+    tutorial();
+
+    REQUIRE(script.empty());
+    onDialog(1, "Welcome");
+    REQUIRE(script == std::vector<std::string>{"1:Welcome"});
+    onDialog(2, "ignored while waiting for skip");
+    onSkip();
+    onDialog(3, "Fight");
+    REQUIRE(script == std::vector<std::string>{"1:Welcome", "skipped", "3:Fight"});
+    onDialog(4, "done");
+    REQUIRE(script.size() == 3);
+}
+
+TEST_CASE("Coroutines awaiting the same raise resume after the listeners", "[coroutine]") {
+    Event<int> onValue("OnValue");
+    std::vector<int> order;
+    onValue.Bind([&](int) { order.push_back(0); });
+
+    auto waiter = [&](int id) -> FireAndForget {
+        int value = co_await onValue.Next();
+        order.push_back(id * 10 + value);
+        // Waiting again inside the resume waits for the next raise
+        value = co_await onValue.Next();
+        order.push_back(id * 100 + value);
+    };
+    waiter(1);
+    waiter(2);
+
+    onValue(1);
+    REQUIRE(order == std::vector<int>{0, 11, 21});
+    onValue(2);
+    REQUIRE(order == std::vector<int>{0, 11, 21, 0, 102, 202});
+}
+
+TEST_CASE("Event streams buffer raises with a bounded capacity", "[coroutine]") {
+    Event<int> onHit("OnHit");
+    std::vector<int> received;
+    bool finished = false;
+
+    auto reader = [&]() -> FireAndForget {
+        auto hits = onHit.Stream(2);
+        while (auto hit = co_await hits.Next()) {
+            received.push_back(*hit);
+            if (*hit == 99) hits.Close();
+        }
+        finished = true;
+    };
+    reader();
+
+    onHit(1);
+    REQUIRE(received == std::vector<int>{1});
+    onHit(2);
+    onHit(99);
+    REQUIRE(received == std::vector<int>{1, 2, 99});
+    REQUIRE(finished);
+    onHit(3);
+    REQUIRE(received.size() == 3);
+}
+
+TEST_CASE("Queued and batched raises reach awaiting coroutines once per payload", "[coroutine][queue]") {
+    Event<int> onHit("OnHit");
+    EventQueue<int> queue(onHit);
+    std::vector<int> awaited;
+    std::vector<int> streamed;
+    int calls = 0;
+    onHit.Bind([&](int) { calls++; });
+
+    auto waiter = [&]() -> FireAndForget {
+        awaited.push_back(co_await onHit.Next());
+        awaited.push_back(co_await onHit.Next());
+    };
+    waiter();
+    auto hits = onHit.Stream(8);
+
+    queue.Push(1);
+    queue.Push(2);
+    queue.Push(3);
+    REQUIRE(queue.Flush() == 3);
+    REQUIRE(calls == 3);
+    REQUIRE(awaited == std::vector<int>{1, 2});
+    REQUIRE(hits.Size() == 3);
+
+#ifdef __cpp_lib_span
+    std::vector<std::tuple<int>> batch{{4}, {5}};
+    onHit.RaiseBatch(std::span<const std::tuple<int>>(batch));
+    const std::vector<int> column{6, 7};
+    onHit.RaiseBatch(std::span<const int>(column));
+    REQUIRE(hits.Size() == 7);
+#endif
+
+    auto reader = [&]() -> FireAndForget {
+        while (auto hit = co_await hits.Next()) streamed.push_back(*hit);
+    };
+    reader();
+    hits.Close();
+#ifdef __cpp_lib_span
+    REQUIRE(streamed == std::vector<int>{1, 2, 3, 4, 5, 6, 7});
+#else
+    REQUIRE(streamed == std::vector<int>{1, 2, 3});
+#endif
+}
+
+TEST_CASE("Consumable raises resume coroutines with whether they were handled", "[coroutine][consumable]") {
+    ConsumableEvent<int> onClick("OnClick");
+    std::vector<std::pair<int, bool>> clicks;
+    onClick.Bind([](int x, Propagation& propagation) { if (x > 10) propagation.Stop(); });
+
+    auto waiter = [&]() -> FireAndForget {
+        for (int i = 0; i < 2; ++i) {
+            auto [x, handled] = co_await onClick.Next();
+            clicks.emplace_back(x, handled);
+        }
+    };
+    waiter();
+    auto stream = onClick.Stream(4);
+
+    REQUIRE_FALSE(onClick(5));
+    REQUIRE(onClick(20));
+    REQUIRE(clicks == std::vector<std::pair<int, bool>>{{5, false}, {20, true}});
+    REQUIRE(stream.Size() == 2);
+}
+
+TEST_CASE("Event streams drop raises once full and keep buffered ones", "[coroutine]") {
+    Event<int> onHit("OnHit");
+    auto hits = onHit.Stream(2);
+    onHit(1);
+    onHit(2);
+    onHit(3);
+    REQUIRE(hits.Size() == 2);
+    REQUIRE(hits.Dropped() == 1);
+
+    std::vector<int> received;
+    auto reader = [&]() -> FireAndForget {
+        while (auto hit = co_await hits.Next()) received.push_back(*hit);
+    };
+    reader();
+    REQUIRE(received == std::vector<int>{1, 2});
+    onHit(4);
+    REQUIRE(received == std::vector<int>{1, 2, 4});
+    hits.Close();
+    REQUIRE(hits.Closed());
+}
+#endif
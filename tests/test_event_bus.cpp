@@ -0,0 +1,90 @@
+#include <catch2/catch_all.hpp>
+#include <Sparkle/EventBus.h>
+
+using namespace Sparkle;
+
+namespace {
+    struct PlayerDied { int Id; };
+    struct LevelLoaded { std::string Name; };
+    struct Unused { int Value; };
+
+    struct DeathCounter {
+        int deaths = 0;
+    };
+}
+
+TEST_CASE("MessageIndex assigns one dense index per type", "[bus]") {
+    const std::size_t died = MessageIndex<PlayerDied>::Value();
+    const std::size_t loaded = MessageIndex<LevelLoaded>::Value();
+    REQUIRE(died != loaded);
+    REQUIRE(MessageIndex<PlayerDied>::Value() == died);
+    REQUIRE(MessageIndex<LevelLoaded>::Value() == loaded);
+    // Dense: every index is below the number of types used so far
+    REQUIRE(died < 3);
+    REQUIRE(loaded < 3);
+}
+
+TEST_CASE("EventBus delivers messages by payload type", "[bus]") {
+    EventBus bus;
+    std::vector<int> deaths;
+    std::vector<std::string> levels;
+    bus.Subscribe<PlayerDied>([&deaths](const PlayerDied &e) { deaths.push_back(e.Id); });
+    bus.Subscribe<PlayerDied>([&deaths](const PlayerDied &e) { deaths.push_back(-e.Id); }, 10);
+    bus.Subscribe<LevelLoaded>([&levels](const LevelLoaded &e) { levels.push_back(e.Name); });
+
+    bus.Publish(PlayerDied{7});
+    bus.Publish(LevelLoaded{"Forest"});
+    // No subscriber, no channel
+    bus.Publish(Unused{1});
+    REQUIRE_FALSE(bus.HasSubscribers<Unused>());
+
+    REQUIRE(deaths == std::vector<int>{-7, 7});
+    REQUIRE(levels == std::vector<std::string>{"Forest"});
+    REQUIRE(bus.HasSubscribers<PlayerDied>());
+
+    // Buses are independent
+    EventBus other;
+    other.Publish(PlayerDied{8});
+    REQUIRE(deaths.size() == 2);
+}
+
+TEST_CASE("EventBus subscriptions are removed by connection, owner or Clear", "[bus]") {
+    EventBus bus;
+    DeathCounter counter;
+    int anonymous = 0;
+    Connection connection = bus.Subscribe<PlayerDied>([&anonymous](const PlayerDied &) { ++anonymous; });
+    bus.Subscribe<PlayerDied>([&counter](const PlayerDied &) { ++counter.deaths; }, &counter);
+    bus.Channel<PlayerDied>().BindOnce([&anonymous](const PlayerDied &) { anonymous += 10; });
+
+    bus.Publish(PlayerDied{1});
+    REQUIRE(anonymous == 11);
+    REQUIRE(counter.deaths == 1);
+
+    REQUIRE(connection.Disconnect());
+    REQUIRE(bus.Unsubscribe<PlayerDied>(&counter));
+    REQUIRE_FALSE(bus.Unsubscribe<LevelLoaded>(&counter));
+    bus.Publish(PlayerDied{2});
+    REQUIRE(anonymous == 11);
+    REQUIRE(counter.deaths == 1);
+
+    Event<PlayerDied> &channel = bus.Channel<PlayerDied>();
+    bus.Subscribe<PlayerDied>([&anonymous](const PlayerDied &) { ++anonymous; });
+    bus.Clear();
+    REQUIRE_FALSE(bus.HasSubscribers<PlayerDied>());
+    REQUIRE(&channel == &bus.Channel<PlayerDied>());
+    bus.Publish(PlayerDied{3});
+    REQUIRE(anonymous == 11);
+}
+
+TEST_CASE("EventBus listeners may subscribe and publish other types while publishing", "[bus]") {
+    EventBus bus;
+    std::vector<std::string> log;
+    bus.Subscribe<PlayerDied>([&](const PlayerDied &e) {
+        log.push_back("died" + std::to_string(e.Id));
+        bus.Subscribe<LevelLoaded>([&log](const LevelLoaded &l) { log.push_back(l.Name); });
+        bus.Publish(LevelLoaded{"Respawn"});
+    });
+
+    bus.Publish(PlayerDied{1});
+    REQUIRE(log == std::vector<std::string>{"died1", "Respawn"});
+}
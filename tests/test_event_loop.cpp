@@ -0,0 +1,101 @@
+#include <catch2/catch_all.hpp>
+#include <Sparkle/EventLoop.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace Sparkle;
+
+TEST_CASE("PollableEventQueue coalesces a burst of posts into one wakeup", "[loop]") {
+    Event<int> onValue("OnValue");
+    PollableEventQueue<int> queue(onValue, 4096);
+    int total = 0;
+    onValue.Bind([&](int v) { total += v; });
+
+    for (int i = 0; i < 1000; ++i) queue.Post(1);
+
+    std::uint64_t writes = 0;
+    REQUIRE(read(queue.Fd(), &writes, sizeof(writes)) == sizeof(writes));
+    REQUIRE(writes == 1);
+
+    REQUIRE(queue.Drain() == 1000);
+    REQUIRE(total == 1000);
+
+    // Cleared: the next post signals again
+    queue.Post(1);
+    REQUIRE(read(queue.Fd(), &writes, sizeof(writes)) == sizeof(writes));
+    REQUIRE(queue.Drain() == 1);
+}
+
+TEST_CASE("EventLoop drains queues posted from other threads", "[loop]") {
+    EventLoop loop;
+    REQUIRE(loop.Valid());
+    Event<int> onValue("OnValue");
+    PollableEventQueue<int> queue(onValue, 64);
+    const auto owner = std::this_thread::get_id();
+    int total = 0;
+    bool onOwner = true;
+    onValue.Bind([&](int v) {
+        total += v;
+        onOwner = onOwner && std::this_thread::get_id() == owner;
+    });
+    REQUIRE(loop.Watch(queue));
+    REQUIRE_FALSE(loop.Watch(queue));
+
+    std::thread producer([&queue]() {
+        for (int i = 0; i < 5000; ++i) queue(1);
+    });
+    while (total < 5000) loop.RunOnce(100);
+    producer.join();
+
+    REQUIRE(total == 5000);
+    REQUIRE(onOwner);
+}
+
+TEST_CASE("EventLoop raises events for ready fds and timers", "[loop]") {
+    EventLoop loop;
+    int fds[2];
+    REQUIRE(pipe(fds) == 0);
+
+    Event<std::uint32_t> onReadable("OnReadable");
+    std::uint32_t flags = 0;
+    onReadable.Bind([&](std::uint32_t ready) {
+        flags = ready;
+        char buffer[16];
+        REQUIRE(read(fds[0], buffer, sizeof(buffer)) > 0);
+    });
+    REQUIRE(loop.Watch(fds[0], onReadable));
+    REQUIRE(loop.RunOnce(0) == 0);
+    REQUIRE(write(fds[1], "x", 1) == 1);
+    REQUIRE(loop.RunOnce(1000) == 1);
+    REQUIRE((flags & EPOLLIN) != 0);
+
+    Event<std::uint64_t> onTick("OnTick");
+    std::uint64_t ticks = 0;
+    int timer = -1;
+    onTick.Bind([&](std::uint64_t expirations) {
+        ticks += expirations;
+        if (ticks >= 3) loop.Remove(timer);
+    });
+    timer = loop.AddTimer(onTick, std::chrono::milliseconds(1));
+    REQUIRE(timer >= 0);
+    REQUIRE(loop.Size() == 2);
+    while (loop.Size() == 2) loop.RunOnce(1000);
+    REQUIRE(ticks >= 3);
+
+    REQUIRE(loop.Remove(fds[0]));
+    REQUIRE_FALSE(loop.Remove(fds[0]));
+    close(fds[0]);
+    close(fds[1]);
+}
+
+TEST_CASE("EventLoop Stop wakes Run from another thread", "[loop]") {
+    EventLoop loop;
+    std::thread stopper([&loop]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        loop.Stop();
+    });
+    loop.Run();
+    stopper.join();
+    SUCCEED();
+}
@@ -0,0 +1,178 @@
+#include <catch2/catch_all.hpp>
+#include <Sparkle/Scheduler.h>
+#include <random>
+
+using namespace Sparkle;
+using std::chrono::milliseconds;
+
+TEST_CASE("RaiseAfter raises once the delay elapsed, with the captured arguments", "[scheduler]") {
+    Scheduler scheduler;
+    Event<int, std::string> onMessage("OnMessage");
+    std::vector<std::string> received;
+    onMessage.Bind([&](int id, const std::string &text) { received.push_back(std::to_string(id) + text); });
+
+    std::string text = "hello";
+    scheduler.RaiseAfter(onMessage, milliseconds(10), 1, text);
+    text = "changed";
+    REQUIRE(scheduler.Size() == 1);
+
+    REQUIRE(scheduler.Advance(milliseconds(9)) == 0);
+    REQUIRE(received.empty());
+    REQUIRE(scheduler.Advance(milliseconds(1)) == 1);
+    REQUIRE(received == std::vector<std::string>{"1hello"});
+    REQUIRE(scheduler.Size() == 0);
+    REQUIRE(scheduler.Advance(milliseconds(100)) == 0);
+}
+
+TEST_CASE("RaiseEvery repeats until cancelled", "[scheduler]") {
+    Scheduler scheduler;
+    Event<> onTick("OnTick");
+    int ticks = 0;
+    onTick.Bind([&]() { ++ticks; });
+
+    const TimerHandle handle = scheduler.RaiseEvery(onTick, milliseconds(5));
+    REQUIRE(scheduler.Advance(milliseconds(4)) == 0);
+    REQUIRE(scheduler.Advance(milliseconds(1)) == 1);
+    // Several periods in one Advance fire once per period
+    REQUIRE(scheduler.Advance(milliseconds(20)) == 4);
+    REQUIRE(ticks == 5);
+
+    REQUIRE(scheduler.Cancel(handle));
+    REQUIRE_FALSE(scheduler.Cancel(handle));
+    REQUIRE_FALSE(scheduler.IsPending(handle));
+    scheduler.Advance(milliseconds(50));
+    REQUIRE(ticks == 5);
+}
+
+TEST_CASE("Scheduler accumulates partial ticks and rounds delays up", "[scheduler]") {
+    Scheduler scheduler(milliseconds(10));
+    int fired = 0;
+    scheduler.After(milliseconds(15), [&]() { ++fired; }); // 2 ticks
+
+    scheduler.Advance(std::chrono::microseconds(9999));
+    scheduler.Advance(std::chrono::microseconds(9999));
+    REQUIRE(fired == 0);
+    scheduler.Advance(std::chrono::microseconds(2));
+    REQUIRE(fired == 1);
+    REQUIRE(scheduler.Elapsed() == milliseconds(20));
+}
+
+TEST_CASE("Timer actions may cancel and schedule timers", "[scheduler]") {
+    Scheduler scheduler;
+    std::vector<int> order;
+    TimerHandle periodic;
+    TimerHandle victim;
+    int repeats = 0;
+
+    periodic = scheduler.Every(milliseconds(2), [&]() {
+        order.push_back(0);
+        if (++repeats == 3) scheduler.Cancel(periodic);
+    });
+    victim = scheduler.After(milliseconds(3), [&]() { order.push_back(-1); });
+    scheduler.After(milliseconds(1), [&]() {
+        order.push_back(1);
+        scheduler.Cancel(victim);
+        scheduler.After(milliseconds(2), [&]() { order.push_back(2); });
+    });
+
+    scheduler.Advance(milliseconds(10));
+    REQUIRE(order == std::vector<int>{1, 0, 2, 0, 0});
+    REQUIRE(scheduler.Size() == 0);
+}
+
+TEST_CASE("Scheduler fires 100k timers at their exact tick", "[scheduler]") {
+    Scheduler scheduler;
+    std::mt19937_64 random(42);
+    std::uniform_int_distribution<std::uint64_t> delays(1, 5000000);
+
+    constexpr std::size_t Count = 100000;
+    std::vector<std::uint64_t> expected(Count);
+    constexpr std::uint64_t Never = static_cast<std::uint64_t>(-1);
+    std::vector<std::uint64_t> firedAt(Count, Never);
+    std::vector<TimerHandle> handles(Count);
+    std::uint64_t now = 0;
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        expected[i] = delays(random);
+        handles[i] = scheduler.After(milliseconds(expected[i]), [&, i]() { firedAt[i] = now; });
+    }
+    REQUIRE(scheduler.Size() == Count);
+
+    // Cancel every third timer
+    std::size_t cancelled = 0;
+    for (std::size_t i = 0; i < Count; i += 3)
+    {
+        REQUIRE(scheduler.Cancel(handles[i]));
+        ++cancelled;
+    }
+    REQUIRE(scheduler.Size() == Count - cancelled);
+
+    // Advance one tick at a time so each fire records its tick, then jump over the rest
+    std::size_t fired = 0;
+    for (; now < 70000; ++now) fired += scheduler.Advance(milliseconds(1));
+    fired += scheduler.Advance(milliseconds(6000000));
+    REQUIRE(fired == Count - cancelled);
+    REQUIRE(scheduler.Size() == 0);
+
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        if (i % 3 == 0) REQUIRE(firedAt[i] == Never);
+        else if (expected[i] <= 70000) REQUIRE(firedAt[i] + 1 == expected[i]);
+        else REQUIRE(firedAt[i] == 70000);
+    }
+}
+
+TEST_CASE("Scheduler handles delays crossing every wheel level", "[scheduler]") {
+    Scheduler scheduler(std::chrono::nanoseconds(1));
+    std::vector<std::uint64_t> order;
+    const std::uint64_t delays[] = {std::uint64_t{1} << 62, 63, 64, 4095, 4096, std::uint64_t{1} << 36, 1};
+    for (std::uint64_t delay : delays)
+    {
+        scheduler.After(std::chrono::nanoseconds(static_cast<std::int64_t>(delay)), [&order, delay]() { order.push_back(delay); });
+    }
+    scheduler.Advance(std::chrono::nanoseconds(10));
+    REQUIRE(order == std::vector<std::uint64_t>{1});
+    scheduler.Advance(std::chrono::nanoseconds(std::int64_t{1} << 62));
+    REQUIRE(order == std::vector<std::uint64_t>{1, 63, 64, 4095, 4096, std::uint64_t{1} << 36, std::uint64_t{1} << 62});
+}
+
+TEST_CASE("Scheduler saturates oversized delays instead of wrapping around", "[scheduler]") {
+    for (const auto resolution : {std::chrono::nanoseconds(1), std::chrono::nanoseconds(milliseconds(1))}) {
+        Scheduler scheduler(resolution);
+        // A late current tick leaves the least room before the tick counter wraps
+        for (int i = 0; i < 3; ++i) scheduler.Advance(Scheduler::Duration::max() / 2);
+        int fired = 0;
+        int soon = 0;
+        const TimerHandle once = scheduler.After(Scheduler::Duration::max(), [&]() { ++fired; });
+        const TimerHandle periodic = scheduler.Every(Scheduler::Duration::max() - std::chrono::nanoseconds(1), [&]() { ++fired; });
+        scheduler.After(milliseconds(5), [&]() { ++soon; });
+
+        REQUIRE(scheduler.Advance(std::chrono::hours(24)) == 1);
+        REQUIRE(soon == 1);
+        REQUIRE(fired == 0);
+        REQUIRE(scheduler.IsPending(once));
+        REQUIRE(scheduler.IsPending(periodic));
+        REQUIRE(scheduler.Cancel(once));
+        REQUIRE(scheduler.Cancel(periodic));
+        REQUIRE(scheduler.Size() == 0);
+    }
+}
+
+TEST_CASE("Scheduler Clear cancels every timer", "[scheduler]") {
+    Scheduler scheduler;
+    int fired = 0;
+    const TimerHandle handle = scheduler.After(milliseconds(1), [&]() { ++fired; });
+    scheduler.Every(milliseconds(1), [&]() { ++fired; });
+    scheduler.Clear();
+    REQUIRE(scheduler.Size() == 0);
+    REQUIRE_FALSE(scheduler.IsPending(handle));
+    scheduler.Advance(milliseconds(10));
+    REQUIRE(fired == 0);
+
+    // Freed slots are reused with a new generation, the old handle stays stale
+    const TimerHandle reused = scheduler.After(milliseconds(1), [&]() { ++fired; });
+    REQUIRE_FALSE(scheduler.Cancel(handle));
+    REQUIRE(scheduler.IsPending(reused));
+    scheduler.Advance(milliseconds(1));
+    REQUIRE(fired == 1);
+}